@@ -207,6 +207,9 @@ void dscLoop() {
 
     // Blocks this task until valid panel data is available
     xSemaphoreTake(dscDataAvailable, portMAX_DELAY);
+    #if dscLatencyStats
+    dscLatencyMark(DSC_LATENCY_WAKEUP);
+    #endif
 
     if (dscStatusChanged) {      // Checks if the security system status has changed
       dscStatusChanged = false;  // Reset the status tracking flag
@@ -218,24 +221,25 @@ void dscLoop() {
         dscBufferOverflow = false;
       }
 
-      // Sends the access code when needed by the panel for arming
+      // Sends the access code when needed by the panel for arming - dscArm() writes the access code itself, this
+      // handles arm keys written without dscArm()
       if (dscAccessCodePrompt) {
         dscAccessCodePrompt = false;
-        dscWriteKeys(accessCode);
+        dscWriteAsync(accessCode, 0, NULL, NULL);
       }
 
       // Sets partition 1 status
       byte partition = 0;
 
       // Publishes armed/disarmed status
-      if (dscArmedChanged[partition]) {
-        dscArmedChanged[partition] = false;  // Resets the partition armed status flag
+      if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ARMED)) {
+        bitClear(dscPartitionChanged[partition], DSC_STATUS_ARMED);  // Resets the partition armed status flag
 
-        if (dscArmed[partition]) {
+        if (dscArmed(partition)) {
           exitState = 0;
 
           // Night armed away
-          if (dscArmedAway[partition] && dscNoEntryDelay[partition]) {
+          if (dscArmedAway(partition) && dscNoEntryDelay(partition)) {
             servicePartition1TargetState.value = HOMEKIT_UINT8(NIGHT_ARM);
             homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
             servicePartition1CurrentState.value = HOMEKIT_UINT8(NIGHT_ARM);
@@ -243,7 +247,7 @@ void dscLoop() {
           }
 
           // Armed away
-          else if (dscArmedAway[partition]) {
+          else if (dscArmedAway(partition)) {
             servicePartition1TargetState.value = HOMEKIT_UINT8(AWAY_ARM);
             homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
             servicePartition1CurrentState.value = HOMEKIT_UINT8(AWAY_ARM);
@@ -251,7 +255,7 @@ void dscLoop() {
           }
 
           // Night armed stay
-          else if (dscArmedStay[partition] && dscNoEntryDelay[partition]) {
+          else if (dscArmedStay(partition) && dscNoEntryDelay(partition)) {
             servicePartition1TargetState.value = HOMEKIT_UINT8(NIGHT_ARM);
             homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
             servicePartition1CurrentState.value = HOMEKIT_UINT8(NIGHT_ARM);
@@ -259,7 +263,7 @@ void dscLoop() {
           }
 
           // Armed stay
-          else if (dscArmedStay[partition]) {
+          else if (dscArmedStay(partition)) {
             servicePartition1TargetState.value = HOMEKIT_UINT8(STAY_ARM);
             homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
             servicePartition1CurrentState.value = HOMEKIT_UINT8(STAY_ARM);
@@ -277,15 +281,15 @@ void dscLoop() {
       }
 
       // Checks exit delay status
-      if (dscExitDelayChanged[partition]) {
-        dscExitDelayChanged[partition] = false;  // Resets the exit delay status flag
+      if (bitRead(dscPartitionChanged[partition], DSC_STATUS_EXIT_DELAY)) {
+        bitClear(dscPartitionChanged[partition], DSC_STATUS_EXIT_DELAY);  // Resets the exit delay status flag
 
         // Exit delay in progress
-        if (dscExitDelay[partition]) {
+        if (dscExitDelay(partition)) {
 
           // Sets the arming target state if the panel is armed externally
-          if (exitState == 0 || dscExitStateChanged[partition]) {
-            dscExitStateChanged[partition] = 0;
+          if (exitState == 0 || bitRead(dscPartitionChanged[partition], DSC_STATUS_EXIT_STATE)) {
+            bitClear(dscPartitionChanged[partition], DSC_STATUS_EXIT_STATE);
             switch (dscExitState[partition]) {
               case DSC_EXIT_STAY: {
                 exitState = 'S';
@@ -308,7 +312,7 @@ void dscLoop() {
         }
 
         // Disarmed during exit delay
-        else if (!dscArmed[partition]) {
+        else if (!dscArmed(partition)) {
           exitState = 0;
           servicePartition1TargetState.value = HOMEKIT_UINT8(DISARMED);
           homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
@@ -318,18 +322,18 @@ void dscLoop() {
       }
 
       // Publishes alarm triggered status
-      if (dscAlarmChanged[partition]) {
-        dscAlarmChanged[partition] = false;  // Resets the partition alarm status flag
-        if (dscAlarm[partition]) {
+      if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ALARM)) {
+        bitClear(dscPartitionChanged[partition], DSC_STATUS_ALARM);  // Resets the partition alarm status flag
+        if (dscAlarm(partition)) {
           servicePartition1CurrentState.value = HOMEKIT_UINT8(ALARM_TRIGGERED);
           homekit_characteristic_notify(&servicePartition1CurrentState, servicePartition1CurrentState.value);
         }
       }
 
       // Publishes fire alarm status
-      if (dscFireChanged[partition]) {
-        dscFireChanged[partition] = false;  // Resets the fire status flag
-        servicePartition1Fire.value = HOMEKIT_UINT8(dscFire[partition]);
+      if (bitRead(dscPartitionChanged[partition], DSC_STATUS_FIRE)) {
+        bitClear(dscPartitionChanged[partition], DSC_STATUS_FIRE);  // Resets the fire status flag
+        servicePartition1Fire.value = HOMEKIT_UINT8(dscFire(partition));
         homekit_characteristic_notify(&servicePartition1Fire, servicePartition1Fire.value);
       }
 
@@ -364,25 +368,43 @@ void dscLoop() {
         }
       }
     }
+
+    // Records the time from the Keybus to the HomeKit notifications
+    #if dscLatencyStats
+    dscLatencyMark(DSC_LATENCY_NOTIFY);
+    #endif
   }
 }
 
 
+// Resets the HomeKit target state to the armed status of the partition, published by dscLoop()
+void resetTargetState(byte partition) {
+  bitSet(dscPartitionChanged[partition], DSC_STATUS_ARMED);
+  dscStatusChanged = true;
+  xSemaphoreGive(dscDataAvailable);
+}
+
+
+// Resets the HomeKit target state if an arm or disarm command fails, for example with an invalid access code
+void targetStateResult(byte result, void *context) {
+  if (result != DSC_WRITE_DONE) resetTargetState((byte) (uintptr_t) context);
+}
+
+
 // Sets the partition 1 target state - clone to add new partitions, set "byte partition" to (partition number -1)
 void setPartition1TargetState(homekit_value_t value) {
   byte partition = 0;
+  void *context = (void *) (uintptr_t) partition;
   servicePartition1TargetState.value = value;
 
   // Resets the HomeKit target state if attempting to change the armed mode while armed or not ready
-  if (value.int_value != DISARMED && !dscReady[partition]) {
-    dscArmedChanged[partition] = true;
-    dscStatusChanged = true;
-    xSemaphoreGive(dscDataAvailable);
+  if (value.int_value != DISARMED && !dscReady(partition)) {
+    resetTargetState(partition);
     return;
   }
 
   // Resets the HomeKit target state if attempting to change the arming mode during the exit delay
-  if (value.int_value != DISARMED && dscExitDelay[partition] && exitState != 0) {
+  if (value.int_value != DISARMED && dscExitDelay(partition) && exitState != 0) {
     if (exitState == 'S') {
       servicePartition1TargetState.value = HOMEKIT_UINT8(STAY_ARM);
       homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
@@ -398,39 +420,41 @@ void setPartition1TargetState(homekit_value_t value) {
   }
 
   // Stay arm
-  if (value.int_value == STAY_ARM && !dscArmed[partition] && !dscExitDelay[partition]) {
-    dscWritePartition = partition + 1;    // Sets writes to the partition number
-    dscWriteKey('s');  // Keypad stay arm
-    servicePartition1TargetState.value = HOMEKIT_UINT8(STAY_ARM);
-    homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
-    exitState = 'S';
+  if (value.int_value == STAY_ARM && !dscArmed(partition) && !dscExitDelay(partition)) {
+    if (dscArm(partition + 1, DSC_ARM_STAY, accessCode, targetStateResult, context)) {  // Keypad stay arm, writes the access code if the panel prompts for it
+      servicePartition1TargetState.value = HOMEKIT_UINT8(STAY_ARM);
+      homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
+      exitState = 'S';
+    }
+    else resetTargetState(partition);
     return;
   }
 
   // Away arm
-  if (value.int_value == AWAY_ARM && !dscArmed[partition] && !dscExitDelay[partition]) {
-    dscWritePartition = partition + 1;    // Sets writes to the partition number
-    dscWriteKey('w');  // Keypad away arm
-    servicePartition1TargetState.value = HOMEKIT_UINT8(AWAY_ARM);
-    homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
-    exitState = 'A';
+  if (value.int_value == AWAY_ARM && !dscArmed(partition) && !dscExitDelay(partition)) {
+    if (dscArm(partition + 1, DSC_ARM_AWAY, accessCode, targetStateResult, context)) {  // Keypad away arm, writes the access code if the panel prompts for it
+      servicePartition1TargetState.value = HOMEKIT_UINT8(AWAY_ARM);
+      homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
+      exitState = 'A';
+    }
+    else resetTargetState(partition);
     return;
   }
 
   // Night arm
-  if (value.int_value == NIGHT_ARM && !dscArmed[partition] && !dscExitDelay[partition]) {
-    dscWritePartition = partition + 1;    // Sets writes to the partition number
-    dscWriteKey('n');  // Keypad arm with no entry delay
-    servicePartition1TargetState.value = HOMEKIT_UINT8(NIGHT_ARM);
-    homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
-    exitState = 'N';
+  if (value.int_value == NIGHT_ARM && !dscArmed(partition) && !dscExitDelay(partition)) {
+    if (dscArm(partition + 1, DSC_ARM_NO_ENTRY_DELAY, accessCode, targetStateResult, context)) {  // Keypad arm with no entry delay, writes the access code if the panel prompts for it
+      servicePartition1TargetState.value = HOMEKIT_UINT8(NIGHT_ARM);
+      homekit_characteristic_notify(&servicePartition1TargetState, servicePartition1TargetState.value);
+      exitState = 'N';
+    }
+    else resetTargetState(partition);
     return;
   }
 
   // Disarm
-  if (value.int_value == DISARMED && (dscArmed[partition] || dscExitDelay[partition])) {
-    dscWritePartition = partition + 1;    // Sets writes to the partition number
-    dscWriteKeys(accessCode);
+  if (value.int_value == DISARMED && (dscArmed(partition) || dscExitDelay(partition))) {
+    if (!dscDisarm(partition + 1, accessCode, targetStateResult, context)) resetTargetState(partition);
     return;
   }
 }
@@ -508,4 +532,8 @@ void user_init(void) {
   // Task setup
   xTaskCreate(&wifiLoop, "wifiLoop", 384, NULL, 1, NULL);
   xTaskCreate(dscLoop, "dscLoop", 256, NULL, 1, NULL);
+  dscWriteQueueBegin(2);  // Writes keys from the HomeKit setter without blocking it
+  #if dscLatencyStats
+  dscLatencyDumpBegin(60000, 1);  // Prints the latency from the Keybus to HomeKit every 60s
+  #endif
 }
@@ -12,3 +12,6 @@
 #define dscReadPin D2   // GPIO: 4
 #define dscWritePin D8  // GPIO: 15
 
+
+// Measures the latency of each command from the Keybus to the HomeKit notifications, printed every 60s
+// #define dscLatencyStats 1
@@ -0,0 +1,150 @@
+/*
+ *  DSC-RTOS Keybus Capture 1.0 (esp8266)
+ *
+ *  Streams every panel command and keypad/module response as a compact binary trace to the serial interface or to a
+ *  TCP client, for decoding offline with extras/KeybusSimulator/dscKeybusTraceDecoder.  Printing each command as
+ *  binary text like KeybusReader takes longer than the Keybus takes to send it - the binary trace is ~5x smaller and
+ *  records each command before the redundant data filters, along with a marker where the Keybus buffer overflowed.
+ *
+ *  Usage (macOS/Linux):
+ *    1. Edit dscSettings.h to configure the GPIO pins, and optionally the WiFi network to send the trace over TCP.
+ *
+ *    2. Edit Makefile to set the esp8266 serial port, baud rate, and flash size.
+ *
+ *    3. Build the example and flash the esp8266:
+ *         $ make flash
+ *       (If a previous flash causes issues, erase before flashing: make erase_flash)
+ *
+ *    4. Capture and decode the trace:
+ *         Serial: $ stty -F /dev/ttyUSB0 460800 raw && cat /dev/ttyUSB0 > trace.bin
+ *         TCP:    $ nc esp8266-address 2323 > trace.bin
+ *
+ *         $ extras/KeybusSimulator/dscKeybusTraceDecoder trace.bin
+ *
+ *  Wiring:
+ *      DSC Aux(+) --- 5v voltage regulator --- esp8266 development board 5v pin (NodeMCU, Wemos)
+ *
+ *      DSC Aux(-) --- esp8266 Ground
+ *
+ *                                         +--- dscClockPin (esp8266: D1, D2, D8)
+ *      DSC Yellow --- 15k ohm resistor ---|
+ *                                         +--- 10k ohm resistor --- Ground
+ *
+ *                                         +--- dscReadPin (esp8266: D1, D2, D8)
+ *      DSC Green ---- 15k ohm resistor ---|
+ *                                         +--- 10k ohm resistor --- Ground
+ *
+ *  Issues and (especially) pull requests are welcome:
+ *  https://github.com/taligentx/dscKeybusInterface-RTOS
+ *
+ *  This example code is in the public domain.
+ */
+
+#include <string.h>
+#include <dscKeybusInterface-RTOS.h>
+#include <lwip/sockets.h>
+
+#define captureBaud 460800
+#define capturePort 2323
+
+int captureClient = -1;
+
+
+// Writes to the TCP client if connected, otherwise directly to the UART - printf() would translate '\n' to "\r\n"
+bool captureWrite(const byte *data, int length) {
+  if (strlen(WIFI_SSID) > 0) {
+    if (captureClient < 0) return true;
+    if (lwip_write(captureClient, data, length) == length) return true;
+    lwip_close(captureClient);
+    captureClient = -1;
+    return false;
+  }
+
+  for (int i = 0; i < length; i++) uart_putc(0, data[i]);
+  return true;
+}
+
+
+// Accepts one TCP client at a time and restarts the trace for each client
+void captureServer(void *pvParameters) {
+  struct sdk_station_config wifi_config = { .ssid = WIFI_SSID, .password = WIFI_PASSWORD, };
+  sdk_wifi_set_opmode(STATION_MODE);
+  sdk_wifi_station_set_config(&wifi_config);
+  sdk_wifi_station_connect();
+
+  int listener = lwip_socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(capturePort);
+  lwip_bind(listener, (struct sockaddr *) &address, sizeof(address));
+  lwip_listen(listener, 1);
+
+  while (1) {
+    int client = lwip_accept(listener, NULL, NULL);
+    if (client < 0) continue;
+    if (captureClient >= 0) {
+      lwip_close(client);
+      continue;
+    }
+    xQueueReset(dscTraceQueue);
+    lwip_write(client, dscTraceHeader, dscTraceHeaderSize);
+    captureClient = client;
+  }
+}
+
+
+void dscCapture() {
+  uint32_t previousTime = 0;
+  bool sendHeader = true;
+  byte output[dscTraceRecordSize];
+  dscTraceRecord record;
+
+  while (1) {
+
+    // Blocks this task until a panel command or keypad/module response is available
+    xQueueReceive(dscTraceQueue, &record, portMAX_DELAY);
+
+    // Time deltas start from the first record for each client
+    if (captureClient < 0 && strlen(WIFI_SSID) > 0) sendHeader = true;
+    if (sendHeader) {
+      if (strlen(WIFI_SSID) == 0) captureWrite((const byte *) dscTraceHeader, dscTraceHeaderSize);
+      previousTime = record.time;
+      sendHeader = false;
+    }
+
+    byte length = dscTraceEncode(&record, &previousTime, output);
+    if (!captureWrite(output, length)) sendHeader = true;
+  }
+}
+
+
+void dscLoop() {
+  while(1) {
+
+    // Blocks this task until valid panel data is available - the trace records each command before this
+    xSemaphoreTake(dscDataAvailable, portMAX_DELAY);
+    dscPanelDataAvailable = false;
+    while (dscHandleModule());
+  }
+}
+
+
+void user_init(void) {
+
+  // Serial setup
+  uart_set_baud(0, captureBaud);
+  vTaskDelay(1);
+
+  // dscKeybusInterface-RTOS setup
+  dscProcessModuleData = true;  // Queues keypad and module responses to the trace
+  dscTraceBegin();
+  dscBegin();
+
+  // Task setup
+  xTaskCreate(dscLoop, "dscLoop", 256, NULL, 1, NULL);
+  xTaskCreate(dscCapture, "dscCapture", 256, NULL, 2, NULL);
+  if (strlen(WIFI_SSID) > 0) xTaskCreate(captureServer, "captureServer", 512, NULL, 1, NULL);
+  else sdk_wifi_set_opmode(NULL_MODE);
+}
@@ -0,0 +1,11 @@
+/*
+ * dscKeybusInterfac-RTOS settings
+ */
+
+// Configures the Keybus interface with the specified GPIO or NodeMCU/Wemos-style pins
+#define dscClockPin D1  // GPIO: 5
+#define dscReadPin D2   // GPIO: 4
+
+// Sends the trace to a TCP client on port 2323 instead of the serial interface if set
+#define WIFI_SSID ""
+#define WIFI_PASSWORD ""
@@ -58,7 +58,7 @@ void dscLoop() {
     // If the Keybus data buffer is exceeded, the program is too busy to process all Keybus commands.  Call
     // dscLoop() more often, or increase dscBufferSize in the library: src/dscKeybusInterface-RTOS.h
     if (dscBufferOverflow) {
-      printf("Keybus buffer overflow\n");
+      dscPrintf("Keybus buffer overflow\n");
       dscBufferOverflow = false;
     }
 
@@ -66,22 +66,23 @@ void dscLoop() {
       dscPanelDataAvailable = false;
 
       // Prints panel data
-      printf("%8.2f: ", millis() / 1000.0);  // Prints a timestamp
-      dscPrintPanelBinary(true);             // Optionally prints without spaces: printPanelBinary(false);
-      printf(" [");
-      dscPrintPanelCommand();                // Prints the panel command as hex
-      printf("] ");
-      dscPrintPanelMessage();                // Prints the decoded message
-      printf("\n");
+      dscPrintf("%8.2f: ", millis() / 1000.0);  // Prints a timestamp
+      dscPrintPanelBinary(true);                // Optionally prints without spaces: printPanelBinary(false);
+      dscPrintf(" [");
+      dscPrintPanelCommand();                   // Prints the panel command as hex
+      dscPrintf("] ");
+      dscPrintPanelMessage();                   // Prints the decoded message
+      dscPrintf("\n");
+      dscReleasePanelData();                    // Returns dscPanelData to the library for the next command
     }
 
     // Prints keypad and module data
-    if (dscHandleModule()) {
-      printf("%8.2f: ", millis() / 1000.0);  // Prints a timestamp
-      dscPrintModuleBinary(true);            // Optionally prints without spaces: printKeybusBinary(false);
-      printf(" ");
-      dscPrintModuleMessage();               // Prints the decoded message
-      printf("\n");
+    while (dscHandleModule()) {
+      dscPrintf("%8.2f: ", millis() / 1000.0);  // Prints a timestamp
+      dscPrintModuleBinary(true);               // Optionally prints without spaces: printKeybusBinary(false);
+      dscPrintf(" ");
+      dscPrintModuleMessage();                  // Prints the decoded message
+      dscPrintf("\n");
     }
   }
 }
@@ -108,7 +109,9 @@ void user_init(void) {
   // dscKeybusInterface-RTOS setup
   dscProcessRedundantData = false;  // Controls if repeated periodic commands are processed and displayed
   dscProcessModuleData = true;      // Controls if keypad and module data is processed and displayed
+  dscRetainPanelData = true;        // Keeps dscPanelData from being overwritten until dscReleasePanelData()
   dscBegin();
+  dscPrintDrainBegin(0);            // Buffers output for a low priority task to write to serial instead of blocking on the UART
 
   // Task setup
   xTaskCreate(dscLoop, "dscLoop", 256, NULL, 1, NULL);
@@ -79,54 +79,54 @@ void dscLoop() {
       for (byte partition = 0; partition < dscPartitions; partition++) {
 
         // Checks ready status
-        if (dscReadyChanged[partition]) {
-          dscReadyChanged[partition] = false;  // Resets the partition ready status flag
-          if (dscReady[partition]) {
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_READY)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_READY);  // Resets the partition ready status flag
+          if (dscReady(partition)) {
             printf("Partition %d ready\n", partition + 1);
           }
         }
 
         // Checks armed status
-        if (dscArmedChanged[partition]) {
-          dscArmedChanged[partition] = false;  // Resets the partition armed status flag
-          if (dscArmed[partition]) {
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ARMED)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_ARMED);  // Resets the partition armed status flag
+          if (dscArmed(partition)) {
             printf("Partition %d armed", partition + 1);
-            if (dscArmedAway[partition]) printf(" away\n");
-            if (dscArmedStay[partition]) printf(" stay\n");
+            if (dscArmedAway(partition)) printf(" away\n");
+            if (dscArmedStay(partition)) printf(" stay\n");
           }
           else printf("Partition %d disarmed\n", partition + 1);
         }
 
         // Checks alarm triggered status
-        if (dscAlarmChanged[partition]) {
-          dscAlarmChanged[partition] = false;  // Resets the partition alarm status flag
-          if (dscAlarm[partition]) {
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ALARM)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_ALARM);  // Resets the partition alarm status flag
+          if (dscAlarm(partition)) {
             printf("Partition %d in alarm\n", partition + 1);
           }
         }
 
         // Checks exit delay status
-        if (dscExitDelayChanged[partition]) {
-          dscExitDelayChanged[partition] = false;  // Resets the exit delay status flag
-          if (dscExitDelay[partition]) {
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_EXIT_DELAY)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_EXIT_DELAY);  // Resets the exit delay status flag
+          if (dscExitDelay(partition)) {
             printf("Partition %d exit delay in progress\n", partition + 1);
           }
-          else if (!dscArmed[partition]) {  // Checks for disarm during exit delay
+          else if (!dscArmed(partition)) {  // Checks for disarm during exit delay
             printf("Partition %d disarmed\n", partition + 1);
           }
         }
 
         // Checks entry delay status
-        if (dscEntryDelayChanged[partition]) {
-          dscEntryDelayChanged[partition] = false;  // Resets the exit delay status flag
-          if (dscEntryDelay[partition]) {
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ENTRY_DELAY)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_ENTRY_DELAY);  // Resets the exit delay status flag
+          if (dscEntryDelay(partition)) {
             printf("Partition %d entry delay in progress\n", partition + 1);
           }
         }
 
         // Checks the access code used to arm or disarm
-        if (dscAccessCodeChanged[partition]) {
-          dscAccessCodeChanged[partition] = false;  // Resets the access code status flag
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ACCESS_CODE)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_ACCESS_CODE);  // Resets the access code status flag
           printf("Partition %d", partition + 1);
           switch (dscAccessCode[partition]) {
             case 33: printf(" duress"); break;
@@ -140,9 +140,9 @@ void dscLoop() {
         }
 
         // Checks fire alarm status
-        if (dscFireChanged[partition]) {
-          dscFireChanged[partition] = false;  // Resets the fire status flag
-          if (dscFire[partition]) {
+        if (bitRead(dscPartitionChanged[partition], DSC_STATUS_FIRE)) {
+          bitClear(dscPartitionChanged[partition], DSC_STATUS_FIRE);  // Resets the fire status flag
+          if (dscFire(partition)) {
             printf("Partition %d fire alarm on\n", partition + 1);
           }
           else {
@@ -0,0 +1,194 @@
+/*
+ *  DSC-RTOS Keybus Benchmark 1.0 (Linux/macOS)
+ *
+ *  Measures the cost of filtering and processing panel commands in dscPanelLoop() by feeding recorded commands
+ *  directly to dscProcessPanelCommand() - the redundant data filters and status processors - on a host computer.
+ *  Prints ns/command and cycles/command overall and the distribution per command byte to track whether changes to
+ *  the filters or processors affect the time available between commands.
+ *
+ *  Usage:
+ *    $ make benchmark
+ *    $ ./dscKeybusBenchmark [-r] [-p] [-n commands] traces/benchmark.txt
+ *
+ *      -r  Processes redundant periodic commands (dscProcessRedundantData)
+ *      -n  Number of commands to process, replaying the trace as needed (default: 1000000)
+ *      -p  Prints the message of each processed command to the dscPrintToNull() output sink, adding the print
+ *          functions to the measurement
+ *      -d  Skips any redundant command (dscSkipRedundantCommands, requires dscRedundantDataHash)
+ *
+ *  The trace uses the same format as the Keybus simulator - keypad/module data, delays, and keys are ignored.
+ *  Cycles are read from the host timestamp counter where available (x86), so compare results on the same host.
+ *
+ *  This example code is in the public domain.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "dscKeybusInterface-RTOS.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define benchmarkCycles() __rdtsc()
+#define benchmarkHasCycles true
+#else
+#define benchmarkCycles() 0
+#define benchmarkHasCycles false
+#endif
+
+#define benchmarkMaxFrames 4096
+
+dscFrame frames[benchmarkMaxFrames];
+unsigned int frameCount;
+
+struct {
+  unsigned long count;
+  unsigned long processed;
+  uint64_t cycles;
+} commandStats[256];
+
+
+// Converts a line of bits to a command the same way dscDataInterrupt() captures it
+void parseFrame(const char *bits, dscFrame *frame) {
+  byte bitCount = 0, byteCount = 0, bitTotal = 0;
+  memset(frame, 0, sizeof(dscFrame));
+
+  for (; *bits && *bits != '|'; bits++) {
+    if (*bits != '0' && *bits != '1') continue;
+    if (byteCount >= dscReadSize) break;
+
+    if (bitCount < 8) {
+      frame->data[byteCount] <<= 1;
+      if (*bits == '1') frame->data[byteCount] |= 1;
+    }
+
+    if (bitTotal == 8) {
+      bitCount = 0;
+      byteCount++;
+    }
+    else if (bitCount < 7) bitCount++;
+    else {
+      bitCount = 0;
+      byteCount++;
+    }
+    bitTotal++;
+  }
+
+  frame->bitCount = bitTotal;
+  frame->byteCount = byteCount;
+  #if dscRedundantDataHash
+  frame->hash = dscPanelDataHash(frame->data, byteCount);
+  #endif
+}
+
+
+bool loadTrace(FILE *trace) {
+  char line[512];
+  while (fgets(line, sizeof(line), trace) && frameCount < benchmarkMaxFrames) {
+    char *entry = line + strspn(line, " \t");
+    if (entry[0] != '0' && entry[0] != '1') continue;
+    parseFrame(entry, &frames[frameCount]);
+    if (frames[frameCount].bitCount >= 8) frameCount++;
+  }
+  return frameCount > 0;
+}
+
+
+int main(int argc, char *argv[]) {
+  int option;
+  unsigned long commandTotal = 1000000;
+  bool printMessages = false;
+  while ((option = getopt(argc, argv, "rdpn:")) != -1) {
+    switch (option) {
+      case 'r': dscProcessRedundantData = true; break;
+      case 'p': printMessages = true; break;
+      case 'n': commandTotal = strtoul(optarg, NULL, 10); break;
+      #if dscRedundantDataHash
+      case 'd': dscSkipRedundantCommands = true; break;
+      #endif
+      default:
+        fprintf(stderr, "Usage: %s [-r] [-d] [-p] [-n commands] trace\n", argv[0]);
+        return 1;
+    }
+  }
+
+  if (optind >= argc) {
+    fprintf(stderr, "Usage: %s [-r] [-d] [-p] [-n commands] trace\n", argv[0]);
+    return 1;
+  }
+  FILE *trace = fopen(argv[optind], "r");
+  if (trace == NULL) {
+    perror(argv[optind]);
+    return 1;
+  }
+  bool loaded = loadTrace(trace);
+  fclose(trace);
+  if (!loaded) {
+    fprintf(stderr, "%s: no commands found\n", argv[optind]);
+    return 1;
+  }
+
+  // Processes the trace once to pass the startup check and fill the redundant data history
+  for (unsigned int i = 0; i < frameCount; i++) {
+    dscPanelFrame = &frames[i];
+    dscPanelData = frames[i].data;
+    dscPanelBitCount = frames[i].bitCount;
+    dscPanelByteCount = frames[i].byteCount;
+    dscProcessPanelCommand();
+  }
+
+  dscPrintOutput = dscPrintToNull;
+  struct timespec startTime, endTime;
+  uint64_t totalCycles = 0;
+  unsigned long processedTotal = 0;
+  clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+  for (unsigned long command = 0; command < commandTotal; command++) {
+    dscFrame *frame = &frames[command % frameCount];
+    uint64_t startCycles = benchmarkCycles();
+
+    dscPanelFrame = frame;
+    dscPanelData = frame->data;
+    dscPanelBitCount = frame->bitCount;
+    dscPanelByteCount = frame->byteCount;
+    bool processed = dscProcessPanelCommand();
+    if (processed && printMessages) dscPrintPanelMessage();
+
+    uint64_t cycles = benchmarkCycles() - startCycles;
+    byte panelCommand = frame->data[0];
+    commandStats[panelCommand].count++;
+    commandStats[panelCommand].cycles += cycles;
+    if (processed) {
+      commandStats[panelCommand].processed++;
+      processedTotal++;
+    }
+    totalCycles += cycles;
+    dscStatusChanged = false;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &endTime);
+  double totalNs = (endTime.tv_sec - startTime.tv_sec) * 1e9 + (endTime.tv_nsec - startTime.tv_nsec);
+
+  printf("Commands: %lu (%u in trace), processed: %lu, redundant data %s\n", commandTotal, frameCount, processedTotal, dscProcessRedundantData ? "processed" : "skipped");
+  if (printMessages) printf("Printed: %lu bytes (%.1f bytes/command)\n", (unsigned long) dscPrintCount, processedTotal ? (double) dscPrintCount / processedTotal : 0);
+  printf("Time: %.1f ns/command", commandTotal ? totalNs / commandTotal : 0);
+  if (benchmarkHasCycles) printf(", %.1f cycles/command", commandTotal ? (double) totalCycles / commandTotal : 0);
+  printf(", %.0f commands/s\n\n", totalNs > 0 ? commandTotal / (totalNs / 1e9) : 0);
+
+  printf("Command  Count      Share   Processed");
+  if (benchmarkHasCycles) printf("  Cycles/command  Cycle share");
+  printf("\n");
+  for (int panelCommand = 0; panelCommand < 256; panelCommand++) {
+    if (commandStats[panelCommand].count == 0) continue;
+    printf("0x%02X     %-10lu %5.1f%%  %-10lu", panelCommand, commandStats[panelCommand].count,
+           100.0 * commandStats[panelCommand].count / commandTotal, commandStats[panelCommand].processed);
+    if (benchmarkHasCycles) {
+      printf(" %-15.1f %5.1f%%", (double) commandStats[panelCommand].cycles / commandStats[panelCommand].count,
+             totalCycles ? 100.0 * commandStats[panelCommand].cycles / totalCycles : 0);
+    }
+    printf("\n");
+  }
+  return 0;
+}
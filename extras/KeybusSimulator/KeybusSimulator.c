@@ -0,0 +1,418 @@
+/*
+ *  DSC-RTOS Keybus Simulator 1.0 (Linux/macOS)
+ *
+ *  Replays a Keybus trace through the library on a host computer by driving the clock and data interrupts with a
+ *  simulated waveform, then decodes and prints the data the same way as the KeybusReader example.  The output is
+ *  deterministic for a given trace, which allows regression checks of the full capture-to-status pipeline without
+ *  an esp8266 or a panel.
+ *
+ *  Usage:
+ *    $ make
+ *    $ ./dscKeybusSimulator [-r] [-m] [-s] [-e] [-p] [-q] [-c] [-l] [-i] [-n count] [-t trace.bin] traces/sample.txt
+ *    $ make check   // Compares the output of the traces with the .expected files in traces/
+ *
+ *      -r  Processes redundant periodic commands (dscProcessRedundantData)
+ *      -m  Processes keypad and module data (dscProcessModuleData)
+ *      -s  Prints the status changes tracked by the library after each command
+ *      -e  Prints status events read as an event subscriber
+ *      -p  Prints through the output ring drained by a low priority task (dscPrintDrainBegin)
+ *      -q  Quiet: skips printing decoded data and prints a throughput summary at the end
+ *      -c  Prints the health counters at the end, as in the quiet summary but without the host time
+ *      -l  Prints the latency of each stage at the end, in simulated time (build with CFLAGS=-DdscLatencyStats=1)
+ *      -i  Prints the interrupt calls by path at the end - cycles are in simulated time, so 0 (build with CFLAGS=-DdscIsrProfile=1)
+ *      -n  Replays the trace the specified number of times (trace files only)
+ *      -t  Captures the replayed commands to a binary trace file, see KeybusTraceDecoder.c
+ *
+ *  Trace format - one entry per line:
+ *    00000101 0 10000001 00000001 10010001 11000111                        Panel command bits as printed by KeybusReader
+ *    00000101 0 10000001 ... | 11111111 1 11111111 ...                    Panel bits followed by keypad/module bits
+ *    delay 500                                                             Holds the clock high for 500ms
+ *    keys *1#                                                              Writes keys with the virtual keypad
+ *    keys 3:*1#                                                            Writes keys to partition 3
+ *    arm 1 stay 1234                                                       Arms partition 1 with dscArm(): stay, away, night
+ *    disarm 1 1234                                                         Disarms partition 1 with dscDisarm()
+ *    bypass 1 2,5 1234                                                     Bypasses zones 2 and 5 on partition 1 with dscBypassZones()
+ *    time 2026-10-17 14:30 1234                                            Sets the panel time with dscSetDateTime()
+ *    # comment
+ *
+ *  This example code is in the public domain.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "dscKeybusInterface-RTOS.h"
+#include "dscSimulator.h"
+
+bool printStatus, printEvents, printDrain, printLatency, printIsrProfile, printCounters, quiet;
+FILE *captureFile;
+unsigned long decodedCommands;
+
+
+void printStatusChanges() {
+  if (!dscStatusChanged) return;
+  dscStatusChanged = false;
+
+  if (dscKeybusChanged) {
+    dscKeybusChanged = false;
+    dscPrintf("          Status: Keybus %s\n", dscKeybusConnected ? "connected" : "disconnected");
+  }
+
+  for (byte partition = 0; partition < dscPartitions; partition++) {
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_READY)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_READY);
+      dscPrintf("          Status: Partition %d %s\n", partition + 1, dscReady(partition) ? "ready" : "not ready");
+    }
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ARMED)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_ARMED);
+      if (dscArmed(partition)) dscPrintf("          Status: Partition %d armed %s\n", partition + 1, dscArmedAway(partition) ? "away" : "stay");
+      else dscPrintf("          Status: Partition %d disarmed\n", partition + 1);
+    }
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ALARM)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_ALARM);
+      if (dscAlarm(partition)) dscPrintf("          Status: Partition %d in alarm\n", partition + 1);
+    }
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_EXIT_DELAY)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_EXIT_DELAY);
+      if (dscExitDelay(partition)) dscPrintf("          Status: Partition %d exit delay in progress\n", partition + 1);
+    }
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ENTRY_DELAY)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_ENTRY_DELAY);
+      if (dscEntryDelay(partition)) dscPrintf("          Status: Partition %d entry delay in progress\n", partition + 1);
+    }
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_FIRE)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_FIRE);
+      dscPrintf("          Status: Partition %d fire %s\n", partition + 1, dscFire(partition) ? "alarm on" : "alarm restored");
+    }
+    if (bitRead(dscPartitionChanged[partition], DSC_STATUS_ACCESS_CODE)) {
+      bitClear(dscPartitionChanged[partition], DSC_STATUS_ACCESS_CODE);
+      dscPrintf("          Status: Partition %d access code %d\n", partition + 1, dscAccessCode[partition]);
+    }
+  }
+
+  if (dscOpenZonesStatusChanged) {
+    dscOpenZonesStatusChanged = false;
+    for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
+      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
+        if (bitRead(dscOpenZonesChanged[zoneGroup], zoneBit)) {
+          bitWrite(dscOpenZonesChanged[zoneGroup], zoneBit, 0);
+          dscPrintf("          Status: Zone %s: %d\n", bitRead(dscOpenZones[zoneGroup], zoneBit) ? "open" : "restored", zoneBit + 1 + (zoneGroup * 8));
+        }
+      }
+    }
+  }
+
+  if (dscAlarmZonesStatusChanged) {
+    dscAlarmZonesStatusChanged = false;
+    for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
+      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
+        if (bitRead(dscAlarmZonesChanged[zoneGroup], zoneBit)) {
+          bitWrite(dscAlarmZonesChanged[zoneGroup], zoneBit, 0);
+          dscPrintf("          Status: Zone alarm%s: %d\n", bitRead(dscAlarmZones[zoneGroup], zoneBit) ? "" : " restored", zoneBit + 1 + (zoneGroup * 8));
+        }
+      }
+    }
+  }
+
+  if (dscTimestampChanged) {
+    dscTimestampChanged = false;
+    dscPrintf("          Status: Timestamp %d.%02d.%02d %02d:%02d\n", dscYear, dscMonth, dscDay, dscHour, dscMinute);
+  }
+
+  if (dscTroubleChanged) {
+    dscTroubleChanged = false;
+    dscPrintf("          Status: Trouble %s\n", dscTrouble ? "on" : "restored");
+  }
+
+  if (dscPowerChanged) {
+    dscPowerChanged = false;
+    dscPrintf("          Status: AC power %s\n", dscPowerTrouble ? "trouble" : "restored");
+  }
+
+  if (dscBatteryChanged) {
+    dscBatteryChanged = false;
+    dscPrintf("          Status: Battery %s\n", dscBatteryTrouble ? "trouble" : "restored");
+  }
+}
+
+
+// Decodes and prints data the same way as the KeybusReader example
+void dscLoop() {
+  while(1) {
+    xSemaphoreTake(dscDataAvailable, portMAX_DELAY);
+    #if dscLatencyStats
+    dscLatencyMark(DSC_LATENCY_WAKEUP);
+    #endif
+
+    if (dscBufferOverflow) {
+      dscPrintf("Keybus buffer overflow\n");  // Printed in quiet mode as well
+      dscBufferOverflow = false;
+    }
+
+    bool panelData = dscPanelDataAvailable;
+    if (panelData) {
+      dscPanelDataAvailable = false;
+      decodedCommands++;
+      if (!quiet) {
+        dscPrintf("%8.2f: ", millis() / 1000.0);
+        dscPrintPanelBinary(true);
+        dscPrintf(" [");
+        dscPrintPanelCommand();
+        dscPrintf("] ");
+        dscPrintPanelMessage();
+        dscPrintf("\n");
+      }
+    }
+
+    while (dscHandleModule()) {
+      if (quiet) continue;
+      dscPrintf("%8.2f: ", millis() / 1000.0);
+      dscPrintModuleBinary(true);
+      dscPrintf(" ");
+      dscPrintModuleMessage();
+      dscPrintf("\n");
+    }
+
+    if (printStatus && !quiet) printStatusChanges();
+    #if dscLatencyStats
+    dscLatencyMark(DSC_LATENCY_NOTIFY);
+    #endif
+    if (panelData) dscReleasePanelData();
+  }
+}
+
+
+// Prints status events as they are received
+void dscEvents() {
+  static const char *eventNames[] = {
+    "Keybus", "Ready", "Armed", "Alarm", "Exit delay", "Exit state", "Entry delay", "Fire", "Access code",
+    "Zone open", "Zone alarm", "Timestamp", "Trouble", "Power trouble", "Battery trouble", "Keypad fire",
+    "Keypad aux", "Keypad panic"
+  };
+
+  int subscriber = dscSubscribe(DSC_EVENT_ALL);
+  dscEvent event;
+  while (dscReadEvent(subscriber, &event, portMAX_DELAY)) {
+    if (dscEventSubscribers[subscriber].overflow) {
+      dscEventSubscribers[subscriber].overflow = false;
+      dscPrintf("Event log overflow\n");
+    }
+    if (quiet) continue;
+    dscPrintf("          Event: %s %d: %d\n", eventNames[event.type], event.index + 1, event.state);
+  }
+}
+
+
+// Writes captured commands to a binary trace the same way as the KeybusCapture example
+void dscCapture() {
+  fwrite(dscTraceHeader, 1, dscTraceHeaderSize, captureFile);
+
+  uint32_t previousTime = 0;
+  while (1) {
+    dscTraceRecord record;
+    byte output[dscTraceRecordSize];
+    xQueueReceive(dscTraceQueue, &record, portMAX_DELAY);
+    fwrite(output, 1, dscTraceEncode(&record, &previousTime, output), captureFile);
+  }
+}
+
+
+// Called by the write queue after the keys requested by the trace are written as a virtual keypad
+void keysWritten(byte result, void *context) {
+  static const char *results[] = { "done", "timeout", "unavailable", "invalid partition", "not read back", "rejected" };
+  if (context != NULL) dscPrintf("Command %s: %s\n", (const char *) context, results[result]);
+  else if (result != DSC_WRITE_DONE) dscPrintf("Keys not written: %s\n", results[result]);
+}
+
+
+// Runs a command from a trace entry: "arm partition mode [code]", "disarm partition code", "bypass partition zones
+// [code]" with the zones separated by commas, or "time YYYY-MM-DD HH:MM [code]"
+void replayCommand(char *entry) {
+  char *command = strtok(entry, " \t");
+  bool queued = false;
+
+  if (strcmp(command, "time") == 0) {
+    struct tm time = { 0 };
+    char *date = strtok(NULL, " \t");
+    char *clock = strtok(NULL, " \t");
+    if (date != NULL && clock != NULL && sscanf(date, "%d-%d-%d", &time.tm_year, &time.tm_mon, &time.tm_mday) == 3 &&
+        sscanf(clock, "%d:%d", &time.tm_hour, &time.tm_min) == 2) {
+      time.tm_year -= 1900;
+      time.tm_mon -= 1;
+      queued = dscSetDateTime(&time, strtok(NULL, " \t"), keysWritten, "time");
+    }
+  }
+  else {
+    char *partitionText = strtok(NULL, " \t");
+    byte partition = partitionText != NULL ? atoi(partitionText) : 0;
+
+    if (strcmp(command, "arm") == 0) {
+      char *mode = strtok(NULL, " \t");
+      char *accessCode = strtok(NULL, " \t");
+      byte armMode = DSC_ARM_AWAY;
+      if (mode != NULL && strcmp(mode, "stay") == 0) armMode = DSC_ARM_STAY;
+      else if (mode != NULL && strcmp(mode, "night") == 0) armMode = DSC_ARM_NO_ENTRY_DELAY;
+      queued = dscArm(partition, armMode, accessCode, keysWritten, "arm");
+    }
+    else if (strcmp(command, "bypass") == 0) {
+      byte zones[dscZones] = { 0 };
+      char *zoneText = strtok(NULL, " \t");
+      while (zoneText != NULL && *zoneText != '\0') {
+        int zone = strtol(zoneText, &zoneText, 10);
+        if (zone >= 1 && zone <= dscZones * 8) bitSet(zones[(zone - 1) / 8], (zone - 1) % 8);
+        if (*zoneText == ',') zoneText++;
+        else break;
+      }
+      queued = dscBypassZones(partition, zones, strtok(NULL, " \t"), keysWritten, "bypass");
+    }
+    else queued = dscDisarm(partition, strtok(NULL, " \t"), keysWritten, "disarm");
+  }
+
+  if (!queued) dscPrintf("Command not queued: %s\n", command);
+  dscSimRunTasks();
+}
+
+
+void replayTrace(FILE *trace) {
+  char line[512];
+  while (fgets(line, sizeof(line), trace)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    char *entry = line + strspn(line, " \t");
+    if (entry[0] == '\0' || entry[0] == '#') continue;
+
+    if (strncmp(entry, "delay", 5) == 0) {
+      dscSimIdle(strtoul(entry + 5, NULL, 10));
+    }
+    else if (strncmp(entry, "keys", 4) == 0) {
+      char *keys = entry + 4 + strspn(entry + 4, " \t");
+      byte partition = 0;
+      if (keys[0] >= '1' && keys[0] <= '8' && keys[1] == ':') {
+        partition = keys[0] - '0';
+        keys += 2;
+      }
+      if (!dscWriteAsync(keys, partition, keysWritten, NULL)) dscPrintf("Keys not queued: %s\n", keys);
+      dscSimRunTasks();
+    }
+    else if (strncmp(entry, "arm", 3) == 0 || strncmp(entry, "disarm", 6) == 0 || strncmp(entry, "bypass", 6) == 0 ||
+             strncmp(entry, "time", 4) == 0) {
+      replayCommand(entry);
+    }
+    else {
+      char *moduleBits = strchr(entry, '|');
+      if (moduleBits) *moduleBits++ = '\0';
+      dscSimSendFrame(entry, moduleBits);
+    }
+  }
+}
+
+
+int main(int argc, char *argv[]) {
+  int option;
+  unsigned long replayCount = 1;
+  while ((option = getopt(argc, argv, "rmsepqclin:t:")) != -1) {
+    switch (option) {
+      case 'r': dscProcessRedundantData = true; break;
+      case 'm': dscProcessModuleData = true; break;
+      case 's': printStatus = true; break;
+      case 'e': printEvents = true; break;
+      case 'p': printDrain = true; break;
+      case 'q': quiet = true; break;
+      case 'c': printCounters = true; break;
+      case 'l': printLatency = true; break;
+      case 'i': printIsrProfile = true; break;
+      case 'n': replayCount = strtoul(optarg, NULL, 10); break;
+      case 't':
+        captureFile = fopen(optarg, "wb");
+        if (captureFile == NULL) {
+          perror(optarg);
+          return 1;
+        }
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-r] [-m] [-s] [-e] [-p] [-q] [-c] [-l] [-i] [-n count] [-t trace.bin] [trace]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  FILE *trace = stdin;
+  if (optind < argc && strcmp(argv[optind], "-") != 0) {
+    trace = fopen(argv[optind], "r");
+    if (trace == NULL) {
+      perror(argv[optind]);
+      return 1;
+    }
+  }
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  // dscKeybusInterface-RTOS setup
+  if (captureFile != NULL) dscTraceBegin();
+  dscRetainPanelData = true;
+  if (!dscBegin()) return 1;
+
+  // Task setup
+  xTaskCreate(dscLoop, "dscLoop", 256, NULL, 1, NULL);
+  dscWriteQueueBegin(0);
+  if (printEvents) {
+    xTaskCreate(dscEvents, "dscEvents", 256, NULL, 1, NULL);
+  }
+  if (captureFile != NULL) xTaskCreate(dscCapture, "dscCapture", 256, NULL, 1, NULL);
+  if (printDrain) dscPrintDrainBegin(0);
+  dscSimRunTasks();
+
+  struct timespec startTime, endTime;
+  clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+  for (unsigned long replay = 0; replay < replayCount; replay++) {
+    if (replay > 0 && fseek(trace, 0, SEEK_SET) != 0) break;
+    replayTrace(trace);
+  }
+  dscSimFlush();
+
+  clock_gettime(CLOCK_MONOTONIC, &endTime);
+  if (trace != stdin) fclose(trace);
+  if (captureFile != NULL) fclose(captureFile);
+
+  if (dscPrintDropped) printf("Output dropped: %lu bytes\n", (unsigned long) dscPrintDropped);
+  if (printLatency) {
+    #if dscLatencyStats
+    dscLatencyPrint();
+    dscSimFlush();
+    #else
+    printf("Latency statistics require building with CFLAGS=-DdscLatencyStats=1\n");
+    #endif
+  }
+  if (printIsrProfile) {
+    #if dscIsrProfile
+    dscIsrProfilePrint();
+    dscSimFlush();
+    #else
+    printf("Interrupt profiling requires building with CFLAGS=-DdscIsrProfile=1\n");
+    #endif
+  }
+  if (quiet) {
+    double hostSeconds = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+    printf("Commands sent: %lu, decoded: %lu\n", dscSimFrames, decodedCommands);
+    printf("Keybus time: %.2fs, host time: %.3fs (%.0f commands/s)\n", dscSimTime / 1e6, hostSeconds, hostSeconds > 0 ? dscSimFrames / hostSeconds : 0);
+  }
+  if (quiet || printCounters) {
+    dscHealthCounters health;
+    dscHealthSnapshot(&health);
+    printf("Captured: %lu, filtered: %lu, redundant: %lu, CRC errors: %lu, overflows: %lu, buffer high water: %u\n",
+           (unsigned long) health.panelFrames, (unsigned long) health.filteredFrames, (unsigned long) health.redundantFrames,
+           (unsigned long) health.crcErrors, (unsigned long) health.overflowFrames, health.bufferHighWater);
+    printf("Module responses: %lu, overflows: %lu, Keybus disconnects: %lu\n", (unsigned long) health.moduleFrames,
+           (unsigned long) health.moduleOverflows, (unsigned long) health.keybusDisconnects);
+    if (health.writeKeys > 0) {
+      printf("Keys written: %lu in %lums (%.1f keys/s)\n", (unsigned long) health.writeKeys, (unsigned long) health.writeTime,
+             health.writeTime > 0 ? health.writeKeys * 1000.0 / health.writeTime : 0);
+    }
+    if (health.writeVerified > 0 || health.writeFailures > 0) {
+      printf("Keys read back: %lu, retries: %lu, failures: %lu, latency: %.0fms mean, %lums max\n",
+             (unsigned long) health.writeVerified, (unsigned long) health.writeRetries, (unsigned long) health.writeFailures,
+             health.writeVerified > 0 ? (double) health.writeLatency / health.writeVerified : 0, (unsigned long) health.writeLatencyMax);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,340 @@
+/*
+ *  DSC-RTOS Keybus Trace Decoder 1.1 (Linux/macOS)
+ *
+ *  Decodes binary Keybus traces captured by the KeybusCapture example (or the simulator -t option) with the same
+ *  dscPrint functions as the KeybusReader example, as text, JSON lines, or CSV.  Serial captures can be decoded
+ *  directly - output before the trace header is skipped.
+ *
+ *  Trace files are split into chunks decoded in parallel by worker processes - the library decodes to global state,
+ *  so each worker is a fork() with its own copy.  The output is in the same order as the trace.
+ *
+ *  Usage:
+ *    $ make
+ *    $ ./dscKeybusTraceDecoder [-f text|json|csv] [-j jobs] [trace.bin ...]
+ *    $ nc esp8266-address 2323 | ./dscKeybusTraceDecoder   // Decodes a live TCP capture
+ *
+ *    -f  Output format: text as printed by KeybusReader (default), JSON lines, or CSV with a header row
+ *    -j  Worker processes per trace file (default: number of CPUs)
+ *
+ *  This example code is in the public domain.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "dscKeybusInterface-RTOS.h"
+
+#define maxJobs 64
+
+enum { formatText, formatJson, formatCsv } outputFormat = formatText;
+int jobs = 1;
+
+// Output sink for the dscPrint functions
+char printBuffer[1024];
+int printLength;
+
+
+void printToBuffer(const char *text, int length) {
+  if (length > (int) sizeof(printBuffer) - 1 - printLength) length = sizeof(printBuffer) - 1 - printLength;
+  memcpy(printBuffer + printLength, text, length);
+  printLength += length;
+  printBuffer[printLength] = '\0';
+}
+
+
+// Moves the printed output to text
+void takeOutput(char *text, size_t size) {
+  size_t length = (size_t) printLength < size ? (size_t) printLength : size - 1;
+  memcpy(text, printBuffer, length);
+  text[length] = '\0';
+  printLength = 0;
+  printBuffer[0] = '\0';
+}
+
+
+// Writes text as a JSON string or CSV field
+void printQuoted(const char *text, FILE *output) {
+  fputc('"', output);
+  for (; *text; text++) {
+    if (*text == '"') fputs(outputFormat == formatJson ? "\\\"" : "\"\"", output);
+    else if (*text == '\\' && outputFormat == formatJson) fputs("\\\\", output);
+    else fputc(*text, output);
+  }
+  fputc('"', output);
+}
+
+
+void printRecord(const dscTraceRecord *record, FILE *output) {
+  char bits[dscReadSize * 9], command[8], message[sizeof(printBuffer)];
+  bool module = record->flags & DSC_TRACE_MODULE;
+
+  dscTraceLoad(record);
+  if (module) {
+    dscPrintModuleBinary(true);
+    takeOutput(bits, sizeof(bits));
+    snprintf(command, sizeof(command), "0x%02X", record->panelCommand);
+    dscPrintModuleMessage();
+  }
+  else {
+    dscPrintPanelBinary(true);
+    takeOutput(bits, sizeof(bits));
+    dscPrintPanelCommand();
+    takeOutput(command, sizeof(command));
+    dscPrintPanelMessage();
+  }
+  takeOutput(message, sizeof(message));
+
+  switch (outputFormat) {
+    case formatText:
+      if (record->flags & DSC_TRACE_OVERFLOW) fprintf(output, "Keybus buffer overflow\n");
+      if (module) fprintf(output, "%8.2f: %s %s\n", record->time / 1000000.0, bits, message);
+      else fprintf(output, "%8.2f: %s [%s] %s\n", record->time / 1000000.0, bits, command, message);
+      break;
+
+    case formatJson:
+      fprintf(output, "{\"time\":%.6f,\"source\":\"%s\",\"command\":\"%s\",\"overflow\":%s,\"bits\":\"%s\",\"message\":",
+              record->time / 1000000.0, module ? "module" : "panel", command,
+              (record->flags & DSC_TRACE_OVERFLOW) ? "true" : "false", bits);
+      printQuoted(message, output);
+      fprintf(output, "}\n");
+      break;
+
+    case formatCsv:
+      fprintf(output, "%.6f,%s,%s,%d,%s,", record->time / 1000000.0, module ? "module" : "panel", command,
+              (record->flags & DSC_TRACE_OVERFLOW) ? 1 : 0, bits);
+      printQuoted(message, output);
+      fprintf(output, "\n");
+      break;
+  }
+}
+
+
+// Decodes records that were validated by scanTrace()
+void decodeRecords(const byte *input, size_t length, uint32_t previousTime, FILE *output) {
+  size_t position = 0;
+  dscTraceRecord record;
+  while (position < length) {
+    int recordLength = dscTraceDecode(input + position, length - position, &previousTime, &record);
+    if (recordLength <= 0) break;
+    printRecord(&record, output);
+    position += recordLength;
+  }
+}
+
+
+// Finds the start of each chunk at a record boundary and the time preceding it.  Returns the length of the complete
+// records - less than length if the trace ends with an invalid or incomplete record.
+size_t scanTrace(const byte *input, size_t length, int chunks, size_t chunkStart[], uint32_t chunkTime[]) {
+  size_t position = 0;
+  uint32_t previousTime = 0;
+  int chunk = 0;
+  dscTraceRecord record;
+
+  while (position < length) {
+    while (chunk < chunks && position >= (length / chunks) * chunk) {
+      chunkStart[chunk] = position;
+      chunkTime[chunk++] = previousTime;
+    }
+    int recordLength = dscTraceDecode(input + position, length - position, &previousTime, &record);
+    if (recordLength <= 0) break;
+    position += recordLength;
+  }
+
+  while (chunk < chunks) {
+    chunkStart[chunk] = position;
+    chunkTime[chunk++] = previousTime;
+  }
+  return position;
+}
+
+
+// Decodes a trace file in parallel chunks, returns false if the trace has an invalid or incomplete record
+bool decodeFile(const char *path) {
+  FILE *trace = fopen(path, "rb");
+  if (trace == NULL) {
+    perror(path);
+    return false;
+  }
+  fseek(trace, 0, SEEK_END);
+  long fileLength = ftell(trace);
+  rewind(trace);
+  byte *input = malloc(fileLength > 0 ? fileLength : 1);
+  if (input == NULL || fread(input, 1, fileLength, trace) != (size_t) fileLength) {
+    fprintf(stderr, "%s: unable to read the trace\n", path);
+    fclose(trace);
+    free(input);
+    return false;
+  }
+  fclose(trace);
+
+  const byte *header = NULL;
+  for (long i = 0; i + dscTraceHeaderSize <= fileLength && header == NULL; i++) {
+    if (memcmp(input + i, dscTraceHeader, dscTraceHeaderSize) == 0) header = input + i;
+  }
+  if (header == NULL) {
+    fprintf(stderr, "%s: no Keybus trace header found\n", path);
+    free(input);
+    return false;
+  }
+  const byte *records = header + dscTraceHeaderSize;
+  size_t length = fileLength - (records - input);
+
+  // Small traces are not worth the fork()
+  int chunks = jobs;
+  if (length < 4096 * (size_t) chunks) chunks = 1;
+
+  size_t chunkStart[maxJobs + 1];
+  uint32_t chunkTime[maxJobs];
+  size_t validLength = scanTrace(records, length, chunks, chunkStart, chunkTime);
+  chunkStart[chunks] = validLength;
+
+  fflush(stdout);
+  if (chunks == 1) decodeRecords(records, validLength, 0, stdout);
+  else {
+    FILE *chunkOutput[maxJobs];
+    pid_t workers[maxJobs];
+    for (int chunk = 0; chunk < chunks; chunk++) {
+      chunkOutput[chunk] = tmpfile();
+      workers[chunk] = chunkOutput[chunk] ? fork() : -1;
+      if (workers[chunk] == 0) {
+        decodeRecords(records + chunkStart[chunk], chunkStart[chunk + 1] - chunkStart[chunk], chunkTime[chunk], chunkOutput[chunk]);
+        fflush(chunkOutput[chunk]);
+        _exit(0);
+      }
+
+      // Decodes the chunk in this process if a worker is not available
+      if (workers[chunk] < 0 && chunkOutput[chunk]) {
+        decodeRecords(records + chunkStart[chunk], chunkStart[chunk + 1] - chunkStart[chunk], chunkTime[chunk], chunkOutput[chunk]);
+      }
+    }
+
+    for (int chunk = 0; chunk < chunks; chunk++) {
+      if (workers[chunk] > 0) waitpid(workers[chunk], NULL, 0);
+      if (chunkOutput[chunk] == NULL) {
+        decodeRecords(records + chunkStart[chunk], chunkStart[chunk + 1] - chunkStart[chunk], chunkTime[chunk], stdout);
+        continue;
+      }
+      char buffer[65536];
+      size_t readLength;
+      rewind(chunkOutput[chunk]);
+      while ((readLength = fread(buffer, 1, sizeof(buffer), chunkOutput[chunk])) > 0) fwrite(buffer, 1, readLength, stdout);
+      fclose(chunkOutput[chunk]);
+    }
+  }
+  fflush(stdout);
+
+  bool valid = true;
+  if (validLength < length) {
+    dscTraceRecord record;
+    uint32_t previousTime = 0;
+    if (dscTraceDecode(records + validLength, length - validLength, &previousTime, &record) == 0) {
+      fprintf(stderr, "%s: incomplete trace record at the end of the trace\n", path);
+    }
+    else fprintf(stderr, "%s: invalid trace record at byte %zu\n", path, (size_t) (records - input) + validLength);
+    valid = false;
+  }
+  free(input);  // Freed after the diagnosis, which reads the trailing record from the input
+  return valid;
+}
+
+
+// Skips input until the trace header, returns false at the end of the input
+bool findHeader(FILE *trace) {
+  const char *header = dscTraceHeader;
+  byte matched = 0;
+  int input;
+  while ((input = fgetc(trace)) != EOF) {
+    if (input == (byte) header[matched]) matched++;
+    else matched = (input == (byte) header[0]) ? 1 : 0;
+    if (matched == dscTraceHeaderSize) return true;
+  }
+  return false;
+}
+
+
+// Decodes a live trace from stdin as each record arrives
+bool decodeStream(FILE *trace) {
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  if (!findHeader(trace)) {
+    fprintf(stderr, "No Keybus trace header found\n");
+    return false;
+  }
+
+  byte input[dscTraceRecordSize];
+  int inputLength = 0;
+  uint32_t previousTime = 0;
+  unsigned long records = 0;
+  while (1) {
+    int inputByte = fgetc(trace);
+    if (inputByte == EOF) break;
+    input[inputLength++] = inputByte;
+
+    dscTraceRecord record;
+    int recordLength = dscTraceDecode(input, inputLength, &previousTime, &record);
+    if (recordLength == 0 && inputLength < dscTraceRecordSize) continue;
+    if (recordLength <= 0) {
+      fprintf(stderr, "Invalid trace record after %lu records\n", records);
+      return false;
+    }
+
+    printRecord(&record, stdout);
+    records++;
+    inputLength = 0;
+  }
+
+  if (inputLength > 0) {
+    fprintf(stderr, "Incomplete trace record at the end of the trace\n");
+    return false;
+  }
+  return true;
+}
+
+
+void printUsage(const char *program) {
+  fprintf(stderr, "Usage: %s [-f text|json|csv] [-j jobs] [trace.bin ...]\n", program);
+}
+
+
+int main(int argc, char *argv[]) {
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  jobs = cpus > 0 ? (cpus < maxJobs ? cpus : maxJobs) : 1;
+
+  int option;
+  while ((option = getopt(argc, argv, "f:j:h")) != -1) {
+    switch (option) {
+      case 'f':
+        if (strcmp(optarg, "text") == 0) outputFormat = formatText;
+        else if (strcmp(optarg, "json") == 0) outputFormat = formatJson;
+        else if (strcmp(optarg, "csv") == 0) outputFormat = formatCsv;
+        else {
+          printUsage(argv[0]);
+          return 1;
+        }
+        break;
+      case 'j':
+        jobs = atoi(optarg);
+        if (jobs < 1) jobs = 1;
+        if (jobs > maxJobs) jobs = maxJobs;
+        break;
+      default:
+        printUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  dscPrintOutput = printToBuffer;
+  if (outputFormat == formatCsv) printf("time,source,command,overflow,bits,message\n");
+
+  int status = 0;
+  if (optind >= argc) status = !decodeStream(stdin);
+  for (int i = optind; i < argc; i++) {
+    if (strcmp(argv[i], "-") == 0) {
+      if (!decodeStream(stdin)) status = 1;
+    }
+    else if (!decodeFile(argv[i])) status = 1;
+  }
+  return status;
+}
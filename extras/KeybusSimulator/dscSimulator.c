@@ -0,0 +1,461 @@
+/*
+    DSC Keybus Interface-RTOS simulator
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _XOPEN_SOURCE 700
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "dscKeybusInterface-RTOS.h"
+#include "dscSimulator.h"
+
+#ifndef dscWritePin
+#define dscWritePin 255
+#endif
+
+#define dscSimMaxTasks 8
+#define dscSimStackSize (256 * 1024)
+#define dscSimNoWake UINT64_MAX
+
+struct dscSimTask {
+  ucontext_t context;
+  TaskFunction_t code;
+  void *parameters;
+  const char *name;
+  bool blocked;
+  bool signaled;            // Set when a notification, semaphore, or queue may have released the task
+  uint64_t wakeTime;
+  uint32_t notifyCount;
+};
+
+struct dscSimQueue {
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t count;
+  UBaseType_t head;
+  uint8_t *items;
+};
+
+uint64_t dscSimTime;
+unsigned long dscSimEdges;
+unsigned long dscSimFrames;
+
+static struct dscSimTask dscSimTasks[dscSimMaxTasks];
+static byte dscSimTaskCount;
+static struct dscSimTask *dscSimCurrentTask;
+static ucontext_t dscSimSchedulerContext;
+
+static bool dscSimClockLevel = true;
+static bool dscSimDataLevel = true;
+static bool dscSimWriteLevel = false;
+static bool dscSimPinLevels[17];
+static char dscSimPendingModuleBit = '1';
+static gpio_interrupt_handler_t dscSimClockHandler;
+static _xt_isr dscSimTimerHandler;
+static void *dscSimTimerArg;
+static uint32_t dscSimTimerTimeout = 250;
+static bool dscSimTimerRunning;
+static uint64_t dscSimTimerDue = dscSimNoWake;
+
+
+/*
+ *  Scheduler
+ */
+
+static void dscSimSignalTasks() {
+  for (byte i = 0; i < dscSimTaskCount; i++) dscSimTasks[i].signaled = true;
+}
+
+
+static bool dscSimTaskRunnable(struct dscSimTask *task) {
+  return !task->blocked || task->signaled || task->wakeTime <= dscSimTime;
+}
+
+
+// Blocks the current task until it is signaled or the timeout expires, returns false on timeout
+static bool dscSimBlock(TickType_t ticksToWait) {
+  struct dscSimTask *task = dscSimCurrentTask;
+  if (task == NULL || ticksToWait == 0) return false;
+
+  task->blocked = true;
+  task->signaled = false;
+  if (ticksToWait == portMAX_DELAY) task->wakeTime = dscSimNoWake;
+  else task->wakeTime = dscSimTime + (uint64_t) ticksToWait * portTICK_PERIOD_MS * 1000;
+  swapcontext(&task->context, &dscSimSchedulerContext);
+  task->blocked = false;
+
+  return task->signaled || task->wakeTime > dscSimTime;
+}
+
+
+static void dscSimTaskStart(int taskIndex) {
+  struct dscSimTask *task = &dscSimTasks[taskIndex];
+  task->code(task->parameters);
+
+  // FreeRTOS tasks must not return - parks the task permanently
+  task->blocked = true;
+  task->signaled = false;
+  task->wakeTime = dscSimNoWake;
+  swapcontext(&task->context, &dscSimSchedulerContext);
+}
+
+
+void dscSimRunTasks() {
+  bool taskRan;
+  do {
+    taskRan = false;
+    for (byte i = 0; i < dscSimTaskCount; i++) {
+      struct dscSimTask *task = &dscSimTasks[i];
+      if (!dscSimTaskRunnable(task)) continue;
+      dscSimCurrentTask = task;
+      swapcontext(&dscSimSchedulerContext, &task->context);
+      dscSimCurrentTask = NULL;
+      taskRan = true;
+    }
+  } while (taskRan);
+}
+
+
+static uint64_t dscSimNextWake() {
+  uint64_t nextWake = dscSimNoWake;
+  for (byte i = 0; i < dscSimTaskCount; i++) {
+    if (dscSimTasks[i].blocked && dscSimTasks[i].wakeTime < nextWake) nextWake = dscSimTasks[i].wakeTime;
+  }
+  return nextWake;
+}
+
+
+void dscSimAdvance(uint32_t us) {
+  uint64_t targetTime = dscSimTime + us;
+  dscSimRunTasks();
+
+  while (dscSimTime < targetTime) {
+    uint64_t nextEvent = targetTime;
+    if (dscSimTimerRunning && dscSimTimerDue < nextEvent) nextEvent = dscSimTimerDue;
+    uint64_t nextWake = dscSimNextWake();
+    if (nextWake < nextEvent) nextEvent = nextWake;
+    if (nextEvent > dscSimTime) dscSimTime = nextEvent;
+
+    if (dscSimTimerRunning && dscSimTimerDue <= dscSimTime) {
+      dscSimTimerDue = dscSimTime + dscSimTimerTimeout;  // Reloads as FRC1 does until the handler stops the timer
+      if (dscSimTimerHandler) dscSimTimerHandler(dscSimTimerArg);
+    }
+    dscSimRunTasks();
+  }
+}
+
+
+BaseType_t xTaskCreate(TaskFunction_t taskCode, const char *name, uint16_t stackDepth, void *parameters, UBaseType_t priority, TaskHandle_t *createdTask) {
+  (void) stackDepth;
+  (void) priority;
+  if (dscSimTaskCount >= dscSimMaxTasks) return pdFAIL;
+
+  struct dscSimTask *task = &dscSimTasks[dscSimTaskCount];
+  memset(task, 0, sizeof(*task));
+  task->code = taskCode;
+  task->parameters = parameters;
+  task->name = name;
+  getcontext(&task->context);
+  task->context.uc_stack.ss_sp = malloc(dscSimStackSize);
+  task->context.uc_stack.ss_size = dscSimStackSize;
+  task->context.uc_link = NULL;
+  makecontext(&task->context, (void (*)(void)) dscSimTaskStart, 1, (int) dscSimTaskCount);
+  dscSimTaskCount++;
+
+  if (createdTask) *createdTask = task;
+  return pdPASS;
+}
+
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+  return dscSimCurrentTask;
+}
+
+
+TickType_t xTaskGetTickCount(void) {
+  return (TickType_t) (dscSimTime / (portTICK_PERIOD_MS * 1000));
+}
+
+
+void vTaskDelay(TickType_t ticks) {
+  if (ticks == 0) ticks = 1;
+  while (dscSimBlock(ticks));
+}
+
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+  struct dscSimTask *task = dscSimCurrentTask;
+  if (task == NULL) return 0;
+
+  while (task->notifyCount == 0) {
+    if (!dscSimBlock(ticksToWait)) break;
+  }
+
+  uint32_t notifyCount = task->notifyCount;
+  if (notifyCount > 0) {
+    if (clearCountOnExit) task->notifyCount = 0;
+    else task->notifyCount--;
+  }
+  return notifyCount;
+}
+
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  if (task == NULL) return pdFAIL;
+  task->notifyCount++;
+  task->signaled = true;
+  return pdPASS;
+}
+
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken) {
+  xTaskNotifyGive(task);
+  if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+}
+
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  struct dscSimQueue *queue = calloc(1, sizeof(struct dscSimQueue));
+  queue->length = length;
+  queue->itemSize = itemSize;
+  if (itemSize > 0) queue->items = malloc(length * itemSize);
+  return queue;
+}
+
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait) {
+  while (queue->count >= queue->length) {
+    if (!dscSimBlock(ticksToWait)) return errQUEUE_FULL;
+  }
+
+  if (queue->itemSize > 0) {
+    UBaseType_t tail = (queue->head + queue->count) % queue->length;
+    memcpy(queue->items + tail * queue->itemSize, item, queue->itemSize);
+  }
+  queue->count++;
+  dscSimSignalTasks();
+  return pdPASS;
+}
+
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *higherPriorityTaskWoken) {
+  if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+  return xQueueSend(queue, item, 0);
+}
+
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticksToWait) {
+  while (queue->count == 0) {
+    if (!dscSimBlock(ticksToWait)) return pdFALSE;
+  }
+
+  if (queue->itemSize > 0) {
+    memcpy(item, queue->items + queue->head * queue->itemSize, queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+  }
+  queue->count--;
+  dscSimSignalTasks();
+  return pdTRUE;
+}
+
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  return queue->count;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+  return xQueueCreate(1, 0);
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+  SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+  mutex->count = 1;
+  return mutex;
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+  return xQueueReceive(semaphore, NULL, ticksToWait);
+}
+
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  if (semaphore->count >= semaphore->length) return pdFALSE;
+  return xQueueSend(semaphore, NULL, 0);
+}
+
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *higherPriorityTaskWoken) {
+  if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+  return xSemaphoreGive(semaphore);
+}
+
+
+/*
+ *  GPIO, timer, and system time
+ */
+
+bool dscSimGpioRead(uint8_t gpio_num) {
+  if (gpio_num == dscClockPin) return dscSimClockLevel;
+  if (gpio_num == dscReadPin) return dscSimDataLevel && !dscSimWriteLevel;  // The virtual keypad pulls the data line low
+  if (gpio_num < sizeof(dscSimPinLevels)) return dscSimPinLevels[gpio_num];
+  return false;
+}
+
+
+void dscSimGpioWrite(uint8_t gpio_num, bool set) {
+  if (gpio_num == dscWritePin) dscSimWriteLevel = set;
+  if (gpio_num < sizeof(dscSimPinLevels)) dscSimPinLevels[gpio_num] = set;
+}
+
+
+void gpio_set_interrupt(const uint8_t gpio_num, const gpio_inttype_t int_type, gpio_interrupt_handler_t handler) {
+  if (gpio_num == dscClockPin && int_type == GPIO_INTTYPE_EDGE_ANY) dscSimClockHandler = handler;
+}
+
+
+void _xt_isr_attach(uint8_t i, _xt_isr func, void *arg) {
+  if (i != INUM_TIMER_FRC1) return;
+  dscSimTimerHandler = func;
+  dscSimTimerArg = arg;
+}
+
+
+void timer_set_interrupts(const timer_frc_t frc, bool enable) {
+  (void) frc;
+  (void) enable;
+}
+
+
+void timer_set_run(const timer_frc_t frc, const bool run) {
+  if (frc != FRC1) return;
+  dscSimTimerRunning = run;
+  if (run) dscSimTimerDue = dscSimTime + dscSimTimerTimeout;
+}
+
+
+void timer_set_reload(const timer_frc_t frc, const bool reload) {
+  (void) frc;
+  (void) reload;
+}
+
+
+bool timer_set_timeout(const timer_frc_t frc, uint32_t us) {
+  if (frc == FRC1) dscSimTimerTimeout = us;
+  return true;
+}
+
+
+uint32_t sdk_system_get_time(void) {
+  return (uint32_t) dscSimTime;
+}
+
+
+// Simulated 80MHz CPU cycle counter
+uint32_t dscSimCycleCount(void) {
+  return (uint32_t) (dscSimTime * 80);
+}
+
+
+char *itoa(int value, char *str, int base) {
+  if (base == 16) sprintf(str, "%x", value);
+  else if (base == 8) sprintf(str, "%o", value);
+  else sprintf(str, "%d", value);
+  return str;
+}
+
+
+/*
+ *  Keybus waveform
+ */
+
+void dscSimClockEdge(bool level) {
+  if (level == dscSimClockLevel) return;
+  dscSimClockLevel = level;
+  dscSimEdges++;
+  if (dscSimClockHandler) dscSimClockHandler(dscClockPin);
+}
+
+
+void dscSimSetData(bool level) {
+  dscSimDataLevel = level;
+}
+
+
+// Panel data is read while the clock is high and keypad/module data while the clock is low.  A command starts when
+// the clock falls after being held high between commands - this falling edge carries the last module bit of the
+// previous command and ends it in the interface.
+void dscSimSendFrame(const char *panelBits, const char *moduleBits) {
+  char panel[dscReadSize * 8 + 1], module[dscReadSize * 8 + 1];
+  byte panelCount = 0, moduleCount = 0;
+
+  for (const char *bit = panelBits; bit && *bit && panelCount < dscReadSize * 8; bit++) {
+    if (*bit == '0' || *bit == '1') panel[panelCount++] = *bit;
+  }
+  // The module stop bit is not sent on the data line - the interface sets it in byte 1 without reading it
+  byte moduleBitTotal = 0;
+  for (const char *bit = moduleBits; bit && *bit && moduleCount < dscReadSize * 8; bit++) {
+    if (*bit == '0' || *bit == '1') {
+      if (moduleBitTotal++ != 8) module[moduleCount++] = *bit;
+    }
+  }
+  if (panelCount == 0) return;
+  dscSimFrames++;
+
+  dscSimSetData(dscSimPendingModuleBit == '1');
+  dscSimClockEdge(LOW);
+  dscSimAdvance(dscSimHalfPeriod);
+
+  for (byte bit = 0; bit < panelCount; bit++) {
+    dscSimSetData(panel[bit] == '1');
+    dscSimClockEdge(HIGH);
+    dscSimAdvance(dscSimHalfPeriod);
+
+    char moduleBit = bit < moduleCount ? module[bit] : '1';  // The data line idles high when keypads are not sending
+    if (bit == panelCount - 1) {
+      dscSimPendingModuleBit = moduleBit;
+      break;
+    }
+
+    dscSimSetData(moduleBit == '1');
+    dscSimClockEdge(LOW);
+    dscSimAdvance(dscSimHalfPeriod);
+  }
+
+  dscSimSetData(HIGH);
+  dscSimAdvance(dscSimFrameGap);
+}
+
+
+void dscSimIdle(uint32_t ms) {
+  dscSimAdvance(ms * 1000);
+}
+
+
+void dscSimFlush() {
+  dscSimSetData(dscSimPendingModuleBit == '1');
+  dscSimPendingModuleBit = '1';
+  dscSimClockEdge(LOW);
+  dscSimAdvance(dscSimHalfPeriod);
+  dscSimSetData(HIGH);
+  dscSimClockEdge(HIGH);
+  dscSimAdvance(dscSimFrameGap);
+}
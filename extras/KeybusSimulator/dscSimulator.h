@@ -0,0 +1,45 @@
+/*
+    DSC Keybus Interface-RTOS simulator
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef dscSimulator_h
+#define dscSimulator_h
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Keybus timing - the clock runs at ~1kHz and idles high for several milliseconds between commands
+#define dscSimHalfPeriod 500  // Microseconds per clock level
+#define dscSimFrameGap 4000   // Microseconds of clock high between commands, must exceed 1ms to end a command
+
+extern uint64_t dscSimTime;         // Simulated time in microseconds
+extern unsigned long dscSimEdges;   // Clock edges driven since startup
+extern unsigned long dscSimFrames;  // Commands sent since startup
+
+// Scheduler
+void dscSimRunTasks();               // Runs ready tasks until every task is blocked
+void dscSimAdvance(uint32_t us);     // Advances simulated time, firing timer interrupts and waking delayed tasks
+
+// Keybus waveform
+void dscSimClockEdge(bool level);    // Drives the clock line and calls the attached clock interrupt
+void dscSimSetData(bool level);      // Sets the level of the data line as driven by the panel or a keypad
+void dscSimSendFrame(const char *panelBits, const char *moduleBits);  // Sends a command bit by bit, '0' and '1' characters only
+void dscSimIdle(uint32_t ms);        // Holds the clock high between commands
+void dscSimFlush();                  // Ends the last command so the interface stores it
+
+#endif  // dscSimulator_h
@@ -0,0 +1,65 @@
+/*
+ *  FreeRTOS host shim for the DSC Keybus simulator
+ *
+ *  Provides the subset of the FreeRTOS API used by dscKeybusInterface-RTOS as a deterministic, single-core
+ *  cooperative scheduler: tasks run until they block on a delay, notification, semaphore, or queue and simulated
+ *  interrupts only run between tasks, matching the run-to-block behavior of the esp8266 for a given trace.
+ */
+
+#ifndef dscSimFreeRTOS_h
+#define dscSimFreeRTOS_h
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void *);
+typedef struct dscSimTask *TaskHandle_t;
+typedef struct dscSimQueue *QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define pdFALSE ((BaseType_t) 0)
+#define pdTRUE ((BaseType_t) 1)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define errQUEUE_FULL pdFALSE
+#define portMAX_DELAY ((TickType_t) 0xFFFFFFFF)
+#define configTICK_RATE_HZ 100
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t) ((ms) / portTICK_PERIOD_MS))
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+#define portYIELD()
+#define portYIELD_FROM_ISR()
+
+// Tasks
+BaseType_t xTaskCreate(TaskFunction_t taskCode, const char *name, uint16_t stackDepth, void *parameters, UBaseType_t priority, TaskHandle_t *createdTask);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken);
+
+// Queues and semaphores - semaphores are queues with an item size of 0
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *higherPriorityTaskWoken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticksToWait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+#define xQueueSendToBack(queue, item, ticksToWait) xQueueSend(queue, item, ticksToWait)
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *higherPriorityTaskWoken);
+#define uxSemaphoreGetCount(semaphore) uxQueueMessagesWaiting(semaphore)
+
+#endif  // dscSimFreeRTOS_h
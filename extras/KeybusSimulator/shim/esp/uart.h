@@ -0,0 +1,15 @@
+/*
+ *  esp-open-rtos host shim for the DSC Keybus simulator
+ */
+
+#ifndef dscSimUart_h
+#define dscSimUart_h
+
+#include <stdint.h>
+
+static inline void uart_set_baud(int uart_num, int baud) {
+  (void) uart_num;
+  (void) baud;
+}
+
+#endif  // dscSimUart_h
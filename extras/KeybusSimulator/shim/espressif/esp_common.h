@@ -0,0 +1,83 @@
+/*
+ *  esp-open-rtos host shim for the DSC Keybus simulator
+ *
+ *  GPIO, FRC1 timer, and system time are backed by the simulator in dscSimulator.c - the simulated Keybus clock and
+ *  data lines are driven by a trace and the interrupt handlers attached by the library are called at the simulated
+ *  time of each clock edge and timer expiry.
+ */
+
+#ifndef dscSimEspCommon_h
+#define dscSimEspCommon_h
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define IRAM
+
+// GPIO
+typedef enum {
+  GPIO_INPUT,
+  GPIO_OUTPUT,
+  GPIO_OUT_OPEN_DRAIN,
+} gpio_direction_t;
+
+typedef enum {
+  GPIO_INTTYPE_NONE,
+  GPIO_INTTYPE_EDGE_POS,
+  GPIO_INTTYPE_EDGE_NEG,
+  GPIO_INTTYPE_EDGE_ANY,
+  GPIO_INTTYPE_LEVEL_LOW,
+  GPIO_INTTYPE_LEVEL_HIGH,
+} gpio_inttype_t;
+
+typedef void (*gpio_interrupt_handler_t)(uint8_t gpio_num);
+
+bool dscSimGpioRead(uint8_t gpio_num);
+void dscSimGpioWrite(uint8_t gpio_num, bool set);
+void gpio_set_interrupt(const uint8_t gpio_num, const gpio_inttype_t int_type, gpio_interrupt_handler_t handler);
+
+static inline void gpio_enable(const uint8_t gpio_num, const gpio_direction_t direction) {
+  (void) gpio_num;
+  (void) direction;
+}
+
+// Signatures match the digitalRead()/digitalWrite() aliases in the library so the aliased return values are well defined
+static inline int gpio_read(uint8_t gpio_num) {
+  return dscSimGpioRead(gpio_num);
+}
+
+static inline void gpio_write(uint8_t gpio_num, uint8_t set) {
+  dscSimGpioWrite(gpio_num, set);
+}
+
+// FRC1 timer
+typedef enum {
+  FRC1 = 0,
+  FRC2 = 1,
+} timer_frc_t;
+
+#define INUM_TIMER_FRC1 9
+
+typedef void (*_xt_isr)(void *arg);
+void _xt_isr_attach(uint8_t i, _xt_isr func, void *arg);
+
+void timer_set_interrupts(const timer_frc_t frc, bool enable);
+void timer_set_run(const timer_frc_t frc, const bool run);
+void timer_set_reload(const timer_frc_t frc, const bool reload);
+bool timer_set_timeout(const timer_frc_t frc, uint32_t us);
+
+// System
+uint32_t sdk_system_get_time(void);
+uint32_t dscSimCycleCount(void);
+#define dscCycleCount() dscSimCycleCount()
+static inline uint8_t sdk_system_get_cpu_freq(void) { return 80; }
+
+// newlib extension used by the library
+char *itoa(int value, char *str, int base);
+
+// WiFi setup calls from the examples are accepted and ignored
+#define STATION_MODE 1
+static inline bool sdk_wifi_set_opmode(uint8_t opmode) { (void) opmode; return true; }
+
+#endif  // dscSimEspCommon_h
@@ -0,0 +1,2 @@
+// FreeRTOS host shim for the DSC Keybus simulator
+#include "FreeRTOS.h"
@@ -0,0 +1,280 @@
+/*
+    DSC Keybus Interface
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dscKeybusInterface-RTOS.h"
+
+
+// Arms the partition with the keypad arm key for the mode, and writes the access code if the panel prompts for it.
+// Completes when the exit delay starts or the partition is armed.
+bool dscArm(byte partition, byte mode, const char *accessCode, dscWriteCallback callback, void *context) {
+  char keys[2] = { 0, '\0' };
+  switch (mode) {
+    case DSC_ARM_STAY: keys[0] = 's'; break;
+    case DSC_ARM_AWAY: keys[0] = 'w'; break;
+    case DSC_ARM_NO_ENTRY_DELAY: keys[0] = 'n'; break;
+    default: return false;
+  }
+  if (!dscValidAccessCode(accessCode)) return false;
+  return dscCommandBegin(partition, DSC_COMMAND_ARM, keys, accessCode, callback, context);
+}
+
+
+// Disarms the partition with the access code, completes when the partition is disarmed
+bool dscDisarm(byte partition, const char *accessCode, dscWriteCallback callback, void *context) {
+  char keys[dscWriteKeysSize];
+  byte length = 0;
+  if (!dscAddCode(keys, &length, accessCode) || length == 0) return false;
+  return dscCommandBegin(partition, DSC_COMMAND_DISARM, keys, NULL, callback, context);
+}
+
+
+// Bypasses the zones set in zones[] (zone 1 = bit 0 of zones[0], as in dscOpenZones) with *1, followed by the access
+// code if set for panels that require a code to bypass.  Zones that do not fit in dscWriteKeysSize are queued as
+// further sequences by dscCommandWritten(), completes when the # after the last zone is written.
+bool dscBypassZones(byte partition, const byte zones[dscZones], const char *accessCode, dscWriteCallback callback, void *context) {
+  char keys[dscWriteKeysSize];
+  byte length = 0;
+  if (!dscAddKeys(keys, &length, "*1") || !dscAddCode(keys, &length, accessCode)) return false;
+
+  dscCommandState *command = dscCommandClaim(partition, DSC_COMMAND_BYPASS, NULL, callback, context);
+  if (command == NULL) return false;
+  for (byte i = 0; i < dscZones; i++) command->zones[i] = zones[i];
+  command->keysPending = true;
+  dscBypassKeys(command, keys, &length);
+
+  if (!dscWriteAsync(keys, partition, dscCommandWritten, command)) {
+    command->state = DSC_COMMAND_IDLE;
+    return false;
+  }
+  return true;
+}
+
+
+// Appends the zones left to bypass that fit in keys[], and # after the last zone
+void dscBypassKeys(dscCommandState *command, char *keys, byte *length) {
+  for (byte zone = 0; zone < dscZones * 8; zone++) {
+    if (!bitRead(command->zones[zone / 8], zone % 8)) continue;
+    if (!dscAddNumber(keys, length, zone + 1, 2)) return;
+    bitClear(command->zones[zone / 8], zone % 8);
+  }
+  if (dscAddKeys(keys, length, "#")) command->keysPending = false;
+}
+
+
+// Sets the panel time with *6 on partition 1, completes when the keys are written
+bool dscSetDateTime(const struct tm *time, const char *accessCode, dscWriteCallback callback, void *context) {
+  return dscTimeCommandBegin(time->tm_year + 1900, time->tm_mon + 1, time->tm_mday, time->tm_hour, time->tm_min, accessCode, callback, context);
+}
+
+
+// Sets the panel time through the write queue started by dscWriteQueueBegin()
+bool dscSetTime(unsigned int dscYear, byte dscMonth, byte dscDay, byte dscHour, byte dscMinute, const char* dscAccessCode) {
+  return dscTimeCommandBegin(dscYear, dscMonth, dscDay, dscHour, dscMinute, dscAccessCode, NULL, NULL);
+}
+
+
+// Queues the *6 keys on partition 1, returns false if partition 1 is not ready, the date/time is invalid, or the keys
+// cannot be queued
+bool dscTimeCommandBegin(unsigned int year, byte month, byte day, byte hour, byte minute, const char *accessCode, dscWriteCallback callback, void *context) {
+  if (!dscReady(0)) return false;  // Skips if partition 1 is not ready
+  char keys[dscWriteKeysSize];
+  if (!dscTimeKeys(keys, year, month, day, hour, minute, accessCode)) return false;  // Skips if input date/time is invalid
+  return dscCommandBegin(1, DSC_COMMAND_KEYS, keys, NULL, callback, context);
+}
+
+
+// Builds the *6 keys to set the panel time: *6, access code, 1, hhmmMMDDYY, #
+bool dscTimeKeys(char *keys, unsigned int year, byte month, byte day, byte hour, byte minute, const char *accessCode) {
+  if (hour > 23 || minute > 59 || month > 12 || day > 31 || year > 2099 || (year > 99 && year < 1900)) return false;
+  if (year >= 2000) year -= 2000;
+  else if (year >= 1900) year -= 1900;
+
+  byte length = 0;
+  return dscAddKeys(keys, &length, "*6") && dscAddCode(keys, &length, accessCode) && dscAddKeys(keys, &length, "1") &&
+         dscAddNumber(keys, &length, hour, 2) && dscAddNumber(keys, &length, minute, 2) &&
+         dscAddNumber(keys, &length, month, 2) && dscAddNumber(keys, &length, day, 2) &&
+         dscAddNumber(keys, &length, year, 2) && dscAddKeys(keys, &length, "#");
+}
+
+
+// Appends keys to the sequence in keys[] at length, returns false if the sequence would not fit in dscWriteKeysSize
+bool dscAddKeys(char *keys, byte *length, const char *add) {
+  while (*add != '\0') {
+    if (*length >= dscWriteKeysSize - 1) return false;
+    keys[(*length)++] = *add++;
+  }
+  keys[*length] = '\0';
+  return true;
+}
+
+
+// Appends the access code, which may be NULL or empty - returns false if the code is not valid
+bool dscAddCode(char *keys, byte *length, const char *accessCode) {
+  if (!dscValidAccessCode(accessCode)) return false;
+  if (accessCode == NULL) {
+    keys[*length] = '\0';
+    return true;
+  }
+  return dscAddKeys(keys, length, accessCode);
+}
+
+
+// Returns true if the access code is NULL or has up to dscAccessCodeLength keys 0-9
+bool dscValidAccessCode(const char *accessCode) {
+  if (accessCode == NULL) return true;
+  for (byte i = 0; accessCode[i] != '\0'; i++) {
+    if (i >= dscAccessCodeLength || accessCode[i] < '0' || accessCode[i] > '9') return false;
+  }
+  return true;
+}
+
+
+// Appends the value as the number of decimal digits, with leading zeros
+bool dscAddNumber(char *keys, byte *length, unsigned int value, byte digits) {
+  if (*length + digits >= dscWriteKeysSize) return false;
+  for (byte i = digits; i > 0; i--) {
+    keys[*length + i - 1] = '0' + (value % 10);
+    value /= 10;
+  }
+  *length += digits;
+  keys[*length] = '\0';
+  return true;
+}
+
+
+// Queues the keys of a command for the partition, returns false if the partition is invalid or already has a command
+// in progress, or the keys cannot be queued
+bool dscCommandBegin(byte partition, byte type, const char *keys, const char *accessCode, dscWriteCallback callback, void *context) {
+  dscCommandState *command = dscCommandClaim(partition, type, accessCode, callback, context);
+  if (command == NULL) return false;
+
+  if (!dscWriteAsync(keys, partition, dscCommandWritten, command)) {
+    command->state = DSC_COMMAND_IDLE;
+    return false;
+  }
+  return true;
+}
+
+
+// Claims the command state of the partition for a new command, returns NULL if the partition is invalid or already
+// has a command in progress
+dscCommandState *dscCommandClaim(byte partition, byte type, const char *accessCode, dscWriteCallback callback, void *context) {
+  if (partition == 0 || partition > dscPartitions) return NULL;
+  if (accessCode != NULL && strlen(accessCode) > dscAccessCodeLength) return NULL;
+  dscCommandState *command = &dscCommandStates[partition - 1];
+
+  bool claimed = false;
+  taskENTER_CRITICAL();
+  if (command->state == DSC_COMMAND_IDLE) {
+    command->state = DSC_COMMAND_WRITING;
+    claimed = true;
+  }
+  taskEXIT_CRITICAL();
+  if (!claimed) return NULL;
+
+  command->type = type;
+  command->partition = partition;
+  command->prompt = false;
+  command->rejected = false;
+  command->codeWritten = false;
+  command->keysPending = false;
+  if (accessCode != NULL) strcpy(command->accessCode, accessCode);
+  else command->accessCode[0] = '\0';
+  command->callback = callback;
+  command->context = context;
+  return command;
+}
+
+
+// Called by the write queue after the keys of a command are written
+void dscCommandWritten(byte result, void *context) {
+  dscCommandState *command = context;
+
+  // Queues the zones of a bypass that did not fit in the previous sequence
+  if (result == DSC_WRITE_DONE && command->type == DSC_COMMAND_BYPASS && command->keysPending) {
+    char keys[dscWriteKeysSize];
+    byte length = 0;
+    keys[0] = '\0';
+    dscBypassKeys(command, keys, &length);
+    if (!dscWriteAsync(keys, command->partition, dscCommandWritten, command)) dscCommandFinish(command, DSC_WRITE_UNAVAILABLE);
+  }
+  else if (result != DSC_WRITE_DONE || command->type == DSC_COMMAND_KEYS || command->type == DSC_COMMAND_BYPASS) {
+    dscCommandFinish(command, result);
+  }
+  else {
+    command->startTime = xTaskGetTickCount();
+    command->state = DSC_COMMAND_CONFIRMING;
+  }
+}
+
+
+// Tracks commands waiting for the panel, called by dscWriteLoop().  Returns true while a command is in progress so
+// dscWriteLoop() keeps checking.
+bool dscCommandStep() {
+  bool active = false;
+  for (byte i = 0; i < dscPartitions; i++) {
+    dscCommandState *command = &dscCommandStates[i];
+    if (command->state == DSC_COMMAND_IDLE) continue;
+    active = true;
+    if (command->state != DSC_COMMAND_CONFIRMING) continue;
+
+    bool confirmed;
+    if (command->type == DSC_COMMAND_ARM) confirmed = dscArmed(i) || dscExitDelay(i);
+    else confirmed = !dscArmed(i) && !dscExitDelay(i);
+
+    if (command->rejected) dscCommandFinish(command, DSC_WRITE_REJECTED);
+    else if (confirmed) dscCommandFinish(command, DSC_WRITE_DONE);
+
+    // Writes the access code once if the panel prompts for it after an arm key
+    else if (command->prompt && !command->codeWritten && command->accessCode[0] != '\0') {
+      command->prompt = false;
+      command->codeWritten = true;
+      command->state = DSC_COMMAND_WRITING;
+      if (!dscWriteAsync(command->accessCode, command->partition, dscCommandWritten, command)) {
+        dscCommandFinish(command, DSC_WRITE_UNAVAILABLE);
+      }
+    }
+    else if ((xTaskGetTickCount() - command->startTime) * portTICK_PERIOD_MS > dscCommandTimeout) {
+      dscCommandFinish(command, DSC_WRITE_TIMEOUT);
+    }
+  }
+  return active;
+}
+
+
+void dscCommandFinish(dscCommandState *command, byte result) {
+  command->state = DSC_COMMAND_IDLE;
+  if (command->callback != NULL) command->callback(result, command->context);
+}
+
+
+// Called by dscPanelLoop() when the panel prompts for an access code (0x9F), returns true if an arm command on the
+// partition writes the access code
+bool dscCommandPrompt(byte partitionIndex) {
+  dscCommandState *command = &dscCommandStates[partitionIndex];
+  if (command->state == DSC_COMMAND_IDLE || command->type != DSC_COMMAND_ARM || command->accessCode[0] == '\0') return false;
+  command->prompt = true;
+  return true;
+}
+
+
+// Called by dscPanelLoop() when the panel rejects an access code (0x8F)
+void dscCommandRejected(byte partitionIndex) {
+  if (dscCommandStates[partitionIndex].state != DSC_COMMAND_IDLE) dscCommandStates[partitionIndex].rejected = true;
+}
@@ -0,0 +1,499 @@
+/*
+    DSC Keybus Interface
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dscKeybusInterface-RTOS.h"
+
+/*
+ *  Structured decoding - each decoder reads the same bytes as the matching dscPrintPanel_ function in
+ *  dscKeybusPrintData-RTOS.c, which documents the commands and example data.
+ */
+
+
+bool dscDecodePanel(dscDecodedPanel *decoded) {
+  memset(decoded, 0, sizeof(dscDecodedPanel));
+  decoded->command = dscPanelData[0];
+
+  const dscCommand *command = dscPanelCommand();
+  if (dscPanelCommands[dscPanelData[0]].options & dscCmdExtended) decoded->subcommand = dscPanelData[2];
+
+  if (command->decode == NULL) return false;
+  if ((command->options & dscCmdCRC) && !dscValidCRC()) return false;
+
+  command->decode(decoded);
+  return decoded->type != DSC_DECODE_UNKNOWN;
+}
+
+
+bool dscDecodeModule(dscDecodedModule *decoded) {
+  memset(decoded, 0, sizeof(dscDecodedModule));
+  decoded->panelCommand = dscModuleCmd;
+
+  // Keypad fire, auxiliary, and panic alarms
+  switch (dscModuleData[0]) {
+    case 0x77:
+    case 0xBB:
+    case 0xDD:
+      decoded->type = DSC_DECODE_KEYPAD_ALARM;
+      decoded->code = dscModuleData[0];
+      return true;
+  }
+
+  // Keypad slot query response
+  if (dscModuleCmd == 0x11) {
+    decoded->type = DSC_DECODE_SLOTS;
+    for (byte slot = 0; slot < 8; slot++) {
+      if ((dscModuleData[2 + (slot / 4)] & (0xC0 >> ((slot % 4) * 2))) == 0) bitSet(decoded->slots, slot);
+    }
+    return true;
+  }
+
+  // Keypad zone query response
+  if (dscModuleCmd == 0xD5) {
+    decoded->type = DSC_DECODE_SLOT_ZONES;
+    for (byte slot = 0; slot < 8; slot++) {
+      byte slotData = dscModuleData[slot + 2];
+      if (slotData == 0xFF) continue;
+      bitSet(decoded->slots, slot);
+      if ((slotData & 0x03) == 0x03 && (slotData & 0x30) == 0) bitSet(decoded->slotZonesOpen, slot);
+      if ((slotData & 0x03) == 0 && (slotData & 0x30) == 0x30) bitSet(decoded->slotZonesClosed, slot);
+    }
+    return true;
+  }
+
+  // Keypad and module status update notifications
+  if (dscModuleData[4] != 0xFF || dscModuleData[5] != 0xFF) {
+    decoded->type = DSC_DECODE_NOTIFICATION;
+    decoded->code = (dscModuleData[4] != 0xFF) ? dscModuleData[4] : dscModuleData[5];
+    return true;
+  }
+
+  // Keypad keys - partitions 1-4 respond to 0x05 and 5-8 to 0x1B in bytes 2, 3, 8, 9
+  byte keyByte = 2;
+  if (dscModuleCmd == 0x05 || dscModuleCmd == 0x1B) {
+    static const byte keyBytes[] = {2, 3, 8, 9};
+    for (byte i = 0; i < 4; i++) {
+      if (dscModuleData[keyBytes[i]] != 0xFF) {
+        keyByte = keyBytes[i];
+        decoded->partition = i + ((dscModuleCmd == 0x05) ? 1 : 5);
+        break;
+      }
+    }
+  }
+  decoded->type = DSC_DECODE_KEY;
+  decoded->code = dscModuleData[keyByte];
+  return true;
+}
+
+
+/*
+ *  Shared decoders
+ */
+
+
+// Adds a partition with the lights and status message in dscPanelByte and dscPanelByte + 1
+void dscDecodePanelPartition(dscDecodedPanel *decoded, byte partition, byte dscPanelByte) {
+  dscDecodedPartition *decodedPartition = &decoded->partition[decoded->partitionCount++];
+  decodedPartition->number = partition;
+  if (dscPanelData[dscPanelByte + 1] == 0xC7) {
+    decodedPartition->disabled = true;
+    return;
+  }
+  decodedPartition->lights = dscPanelData[dscPanelByte];
+  decodedPartition->message = dscPanelData[dscPanelByte + 1];
+  if (partition > 0) bitSet(decoded->partitions, partition - 1);
+}
+
+
+// Copies zone bit flags starting at dscPanelByte
+void dscDecodePanelZones(dscDecodedPanel *decoded, byte dscPanelByte, byte zoneBytes, byte zoneStart) {
+  decoded->zoneStart = zoneStart;
+  decoded->zoneBytes = zoneBytes;
+  for (byte i = 0; i < zoneBytes; i++) decoded->zones[i] = dscPanelData[dscPanelByte + i];
+}
+
+
+// Status with partitions 1-2 and open zones for commands 0x27, 0x2D, 0x34, 0x3E
+void dscDecodePanelStatusZones(dscDecodedPanel *decoded, byte zoneStart) {
+  decoded->type = DSC_DECODE_STATUS;
+  dscDecodePanelPartition(decoded, 1, 2);
+  if (dscPanelData[5] != 0xFF) dscDecodePanelPartition(decoded, 2, 4);
+  dscDecodePanelZones(decoded, 6, 1, zoneStart);
+}
+
+
+// Status in programming with zone lights for 0xE6 subcommands 0x20, 0x41
+void dscDecodePanelStatusLights(dscDecodedPanel *decoded, byte zoneStart) {
+  decoded->type = DSC_DECODE_STATUS;
+  decoded->partitionCount = 1;
+  decoded->partition[0].lights = dscPanelData[3];
+  decoded->partition[0].message = dscPanelData[4];
+  dscDecodePanelZones(decoded, 5, 4, zoneStart);
+}
+
+
+// Flashing lights with zones 1-32 for commands 0x5D, 0x63
+void dscDecodePanelFlashing(dscDecodedPanel *decoded, byte partitions) {
+  decoded->type = DSC_DECODE_FLASHING;
+  decoded->partitions = partitions;
+  decoded->lights = dscPanelData[2];
+  dscDecodePanelZones(decoded, 3, 4, 1);
+}
+
+
+// One-time beeps for commands 0x64, 0x69, 0xE6 0x19
+void dscDecodePanelBeep(dscDecodedPanel *decoded, byte partitions, byte dscPanelByte) {
+  decoded->partitions = partitions;
+  switch (dscPanelData[dscPanelByte]) {
+    case 0x04:
+    case 0x06:
+    case 0x08:
+    case 0x0C:
+      decoded->type = DSC_DECODE_BEEP;
+      decoded->code = dscPanelData[dscPanelByte] / 2;
+      break;
+    default:
+      decoded->type = DSC_DECODE_MESSAGE;
+      decoded->code = dscPanelData[dscPanelByte];
+      break;
+  }
+}
+
+
+// Repeated beep patterns for commands 0x75, 0x7A, 0xE6 0x1D
+void dscDecodePanelBeepPattern(dscDecodedPanel *decoded, byte partitions, byte dscPanelByte) {
+  decoded->partitions = partitions;
+  switch (dscPanelData[dscPanelByte]) {
+    case 0x00:
+    case 0x11:
+    case 0x31:
+    case 0x80:
+    case 0xB1:
+      decoded->type = DSC_DECODE_BEEP_PATTERN;
+      break;
+    default:
+      decoded->type = DSC_DECODE_MESSAGE;
+      break;
+  }
+  decoded->code = dscPanelData[dscPanelByte];
+}
+
+
+// Long beeps for commands 0x7F, 0x82
+void dscDecodePanelLongBeep(dscDecodedPanel *decoded, byte partitions) {
+  decoded->partitions = partitions;
+  if (dscPanelData[2] == 0x01 || dscPanelData[2] == 0x02) decoded->type = DSC_DECODE_LONG_BEEP;
+  else decoded->type = DSC_DECODE_MESSAGE;
+  decoded->code = dscPanelData[2];
+}
+
+
+// Date and time for commands 0xA5, 0xEB, starting at dscPanelByte
+void dscDecodePanelTime(dscDecodedPanel *decoded, byte dscPanelByte) {
+  byte dscYear3 = dscPanelData[dscPanelByte] >> 4;
+  byte dscYear4 = dscPanelData[dscPanelByte] & 0x0F;
+  decoded->year = ((dscYear3 >= 7) ? 1900 : 2000) + (dscYear3 * 10) + dscYear4;
+  decoded->month = (dscPanelData[dscPanelByte + 1] >> 2) & 0x0F;
+  decoded->day = ((dscPanelData[dscPanelByte + 1] & 0x03) << 3) | (dscPanelData[dscPanelByte + 2] >> 5);
+  decoded->hour = dscPanelData[dscPanelByte + 2] & 0x1F;
+  decoded->minute = dscPanelData[dscPanelByte + 3] >> 2;
+}
+
+
+// Converts the access code offset in status messages to the access code number - codes 35-39 are not used
+byte dscDecodeAccessCode(byte offset) {
+  if (offset >= 35) return offset + 5;
+  return offset;
+}
+
+
+// Sets the event type, zone, or access code of a timestamped message, see dscPrintPanelStatus0() and neighbours
+void dscDecodePanelEvent(dscDecodedPanel *decoded, byte group, byte code) {
+  decoded->type = DSC_DECODE_EVENT;
+  decoded->eventGroup = group;
+  decoded->eventCode = code;
+  decoded->eventType = DSC_PANEL_EVENT_OTHER;
+
+  switch (group) {
+    case 0x00:
+      if (code >= 0x09 && code <= 0x28) { decoded->eventType = DSC_PANEL_EVENT_ZONE_ALARM; decoded->zone = code - 0x08; }
+      else if (code >= 0x29 && code <= 0x48) { decoded->eventType = DSC_PANEL_EVENT_ZONE_ALARM_RESTORED; decoded->zone = code - 0x28; }
+      else if (code >= 0x56 && code <= 0x75) { decoded->eventType = DSC_PANEL_EVENT_ZONE_TAMPER; decoded->zone = code - 0x55; }
+      else if (code >= 0x76 && code <= 0x95) { decoded->eventType = DSC_PANEL_EVENT_ZONE_TAMPER_RESTORED; decoded->zone = code - 0x75; }
+      else if (code >= 0x99 && code <= 0xBD) { decoded->eventType = DSC_PANEL_EVENT_ARMED; decoded->accessCode = dscDecodeAccessCode(code - 0x98); }
+      else if (code >= 0xC0 && code <= 0xE4) { decoded->eventType = DSC_PANEL_EVENT_DISARMED; decoded->accessCode = dscDecodeAccessCode(code - 0xBF); }
+      break;
+
+    case 0x01:
+      if (code >= 0x24 && code <= 0x28) { decoded->eventType = DSC_PANEL_EVENT_AUTO_ARM_CANCELLED; decoded->accessCode = dscDecodeAccessCode(code - 0x24 + 33); }
+      else if (code >= 0x6C && code <= 0x8B) { decoded->eventType = DSC_PANEL_EVENT_ZONE_FAULT_RESTORED; decoded->zone = code - 0x6B; }
+      else if (code >= 0x8C && code <= 0xAB) { decoded->eventType = DSC_PANEL_EVENT_ZONE_FAULT; decoded->zone = code - 0x8B; }
+      else if (code >= 0xB0 && code <= 0xCF) { decoded->eventType = DSC_PANEL_EVENT_ZONE_BYPASSED; decoded->zone = code - 0xAF; }
+      break;
+
+    case 0x02:
+      if (code >= 0xC6 && code <= 0xE5) { decoded->eventType = DSC_PANEL_EVENT_AUTO_ARM_CANCELLED; decoded->accessCode = code - 0xC5; }
+      else if (code >= 0xE9 && code <= 0xF0) { decoded->eventType = DSC_PANEL_EVENT_SUPERVISORY_RESTORED; decoded->zone = code - 0xE8; }
+      else if (code >= 0xF1 && code <= 0xF8) { decoded->eventType = DSC_PANEL_EVENT_SUPERVISORY_TROUBLE; decoded->zone = code - 0xF0; }
+      break;
+
+    case 0x04:
+      if (code <= 0x1F) { decoded->eventType = DSC_PANEL_EVENT_ZONE_ALARM; decoded->zone = code + 33; }
+      else if (code <= 0x3F) { decoded->eventType = DSC_PANEL_EVENT_ZONE_ALARM_RESTORED; decoded->zone = code + 1; }
+      else if (code <= 0x5F) { decoded->eventType = DSC_PANEL_EVENT_ZONE_TAMPER; decoded->zone = code - 31; }
+      else if (code <= 0x7F) { decoded->eventType = DSC_PANEL_EVENT_ZONE_TAMPER_RESTORED; decoded->zone = code - 63; }
+      break;
+
+    case 0x14:
+      if (code >= 0x40 && code <= 0x5F) { decoded->eventType = DSC_PANEL_EVENT_ZONE_FAULT_RESTORED; decoded->zone = code - 31; }
+      else if (code >= 0x60 && code <= 0x7F) { decoded->eventType = DSC_PANEL_EVENT_ZONE_FAULT; decoded->zone = code - 63; }
+      break;
+  }
+}
+
+
+// Queries and verifications without data: 0x11, 0x1C, 0x28, 0x4C, 0x58, 0xD5
+void dscDecodePanelQuery(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_QUERY;
+}
+
+
+// Messages that are not yet understood: 0x8D, 0xE6 0x1A
+void dscDecodePanelMessage(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_MESSAGE;
+}
+
+
+/*
+ *  Panel commands
+ */
+
+
+// Status - partitions 1-4
+void dscDecodePanel_0x05(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_STATUS;
+  dscDecodePanelPartition(decoded, 1, 2);
+  dscDecodePanelPartition(decoded, 2, 4);
+  if (dscPanelByteCount > 9) {
+    dscDecodePanelPartition(decoded, 3, 6);
+    dscDecodePanelPartition(decoded, 4, 8);
+  }
+}
+
+
+// Status in alarm, programming - zone lights 1-32, and *5 access codes 33, 34, 41, 42 as zones 33, 34, 41, 42
+void dscDecodePanel_0x0A(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_STATUS;
+  dscDecodePanelPartition(decoded, 1, 2);
+  dscDecodePanelZones(decoded, 4, 4, 1);
+  decoded->zoneBytes = 6;
+  if (dscPanelData[8] != 0 && dscPanelData[8] != 128) {
+    decoded->zones[4] = dscPanelData[8] & 0x03;
+    decoded->zones[5] = (dscPanelData[8] >> 3) & 0x03;
+  }
+}
+
+
+// Panel model and zone wiring
+void dscDecodePanel_0x16(dscDecodedPanel *decoded) {
+  if (dscPanelData[2] != 0x0E) return;
+  decoded->type = DSC_DECODE_PANEL_INFO;
+  decoded->code = dscPanelData[3];
+  decoded->detail = dscPanelData[4];
+}
+
+
+#if dscPartitions > 4
+// Status - partitions 5-8
+void dscDecodePanel_0x1B(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_STATUS;
+  dscDecodePanelPartition(decoded, 5, 2);
+  dscDecodePanelPartition(decoded, 6, 4);
+  dscDecodePanelPartition(decoded, 7, 6);
+  dscDecodePanelPartition(decoded, 8, 8);
+}
+#endif
+
+
+void dscDecodePanel_0x27(dscDecodedPanel *decoded) { dscDecodePanelStatusZones(decoded, 1); }
+void dscDecodePanel_0x2D(dscDecodedPanel *decoded) { dscDecodePanelStatusZones(decoded, 9); }
+void dscDecodePanel_0x34(dscDecodedPanel *decoded) { dscDecodePanelStatusZones(decoded, 17); }
+void dscDecodePanel_0x3E(dscDecodedPanel *decoded) { dscDecodePanelStatusZones(decoded, 25); }
+void dscDecodePanel_0x5D(dscDecodedPanel *decoded) { dscDecodePanelFlashing(decoded, 0x01); }
+void dscDecodePanel_0x63(dscDecodedPanel *decoded) { dscDecodePanelFlashing(decoded, 0x02); }
+void dscDecodePanel_0x64(dscDecodedPanel *decoded) { dscDecodePanelBeep(decoded, 0x01, 2); }
+void dscDecodePanel_0x69(dscDecodedPanel *decoded) { dscDecodePanelBeep(decoded, 0x02, 2); }
+void dscDecodePanel_0x75(dscDecodedPanel *decoded) { dscDecodePanelBeepPattern(decoded, 0x01, 2); }
+void dscDecodePanel_0x7A(dscDecodedPanel *decoded) { dscDecodePanelBeepPattern(decoded, 0x02, 2); }
+void dscDecodePanel_0x7F(dscDecodedPanel *decoded) { dscDecodePanelLongBeep(decoded, 0x01); }
+void dscDecodePanel_0x82(dscDecodedPanel *decoded) { dscDecodePanelLongBeep(decoded, 0x02); }
+
+
+// Panel outputs - PGM1/PGM2 and PGM3/PGM4 are only reported by panels that send them
+void dscDecodePanel_0x87(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_OUTPUTS;
+  if ((dscPanelData[2] & 0xF0) == 0xF0) bitSet(decoded->outputs, DSC_OUTPUT_BELL);
+  if ((dscPanelData[3] & 0x0F) <= 0x03) {
+    if (bitRead(dscPanelData[3], 0)) bitSet(decoded->outputs, DSC_OUTPUT_PGM1);
+    if (bitRead(dscPanelData[3], 1)) bitSet(decoded->outputs, DSC_OUTPUT_PGM2);
+  }
+  if ((dscPanelData[2] & 0x0F) != 0x0F) {
+    if (bitRead(dscPanelData[2], 0)) bitSet(decoded->outputs, DSC_OUTPUT_PGM3);
+    if (bitRead(dscPanelData[2], 1)) bitSet(decoded->outputs, DSC_OUTPUT_PGM4);
+  }
+}
+
+
+// Unknown - immediate after entering *5 programming
+void dscDecodePanel_0x94(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_MESSAGE;
+  decoded->code = dscPanelData[9];
+}
+
+
+// Date, time, system status messages - partitions 1-2
+void dscDecodePanel_0xA5(dscDecodedPanel *decoded) {
+  dscDecodePanelTime(decoded, 2);
+  switch (dscPanelData[3] >> 6) {
+    case 0x01: decoded->partitions = 0x01; break;
+    case 0x02: decoded->partitions = 0x02; break;
+  }
+
+  if (dscPanelData[6] == 0 && dscPanelData[7] == 0) {
+    decoded->type = DSC_DECODE_EVENT;
+    decoded->eventType = DSC_PANEL_EVENT_TIMESTAMP;
+    return;
+  }
+  dscDecodePanelEvent(decoded, dscPanelData[5] & 0x03, dscPanelData[6]);
+}
+
+
+// Enabled zones 1-32 for partitions 1-2 - partition[0].zones from bytes 2-5 and partition[1].zones from bytes 6-9
+void dscDecodePanel_0xB1(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_ENABLED_ZONES;
+  decoded->partitions = 0x03;
+  decoded->partitionCount = 2;
+  for (byte partitionIndex = 0; partitionIndex < 2; partitionIndex++) {
+    decoded->partition[partitionIndex].number = partitionIndex + 1;
+    for (byte i = 0; i < 4; i++) decoded->partition[partitionIndex].zones[i] = dscPanelData[2 + (partitionIndex * 4) + i];
+  }
+}
+
+
+// Bell
+void dscDecodePanel_0xBB(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_OUTPUTS;
+  if (bitRead(dscPanelData[2], 5)) bitSet(decoded->outputs, DSC_OUTPUT_BELL);
+}
+
+
+// Keypad status
+void dscDecodePanel_0xC3(dscDecodedPanel *decoded) {
+  if (dscPanelData[3] != 0xFF) return;
+  decoded->type = DSC_DECODE_KEYPAD_STATUS;
+  decoded->code = dscPanelData[2];
+}
+
+
+// Unknown command
+void dscDecodePanel_0xCE(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_MESSAGE;
+  decoded->code = dscPanelData[2];
+  decoded->detail = dscPanelData[3];
+}
+
+
+#if dscPartitions > 4
+// Status in alarm/programming, partitions 5-8
+void dscDecodePanel_0xE6_0x03(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_STATUS;
+  decoded->partitionCount = 1;
+  decoded->partition[0].lights = dscPanelData[2];
+  decoded->partition[0].message = dscPanelData[3];
+}
+#endif
+
+
+#if dscZones > 4
+void dscDecodePanel_0xE6_0x09(dscDecodedPanel *decoded) { decoded->type = DSC_DECODE_ZONES; dscDecodePanelZones(decoded, 3, 1, 33); }
+#endif
+#if dscZones > 5
+void dscDecodePanel_0xE6_0x0B(dscDecodedPanel *decoded) { decoded->type = DSC_DECODE_ZONES; dscDecodePanelZones(decoded, 3, 1, 41); }
+#endif
+#if dscZones > 6
+void dscDecodePanel_0xE6_0x0D(dscDecodedPanel *decoded) { decoded->type = DSC_DECODE_ZONES; dscDecodePanelZones(decoded, 3, 1, 49); }
+#endif
+#if dscZones > 7
+void dscDecodePanel_0xE6_0x0F(dscDecodedPanel *decoded) { decoded->type = DSC_DECODE_ZONES; dscDecodePanelZones(decoded, 3, 1, 57); }
+#endif
+
+
+// Flash panel lights: status and zones 1-32, partitions 1-8
+void dscDecodePanel_0xE6_0x17(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_FLASHING;
+  decoded->partitions = dscPanelData[3];
+  decoded->lights = dscPanelData[4];
+  dscDecodePanelZones(decoded, 5, 4, 1);
+}
+
+
+#if dscZones > 4
+// Flash panel lights: status and zones 33-64, partitions 1-8
+void dscDecodePanel_0xE6_0x18(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_FLASHING;
+  decoded->partitions = dscPanelData[3];
+  decoded->lights = dscPanelData[4];
+  dscDecodePanelZones(decoded, 5, 4, 33);
+}
+#endif
+
+
+#if dscPartitions > 2
+void dscDecodePanel_0xE6_0x19(dscDecodedPanel *decoded) { dscDecodePanelBeep(decoded, dscPanelData[3], 4); }
+void dscDecodePanel_0xE6_0x1D(dscDecodedPanel *decoded) { dscDecodePanelBeepPattern(decoded, dscPanelData[3], 4); }
+#endif
+void dscDecodePanel_0xE6_0x20(dscDecodedPanel *decoded) { dscDecodePanelStatusLights(decoded, 33); }
+void dscDecodePanel_0xE6_0x41(dscDecodedPanel *decoded) { dscDecodePanelStatusLights(decoded, 65); }
+
+
+#if dscPartitions > 2
+// Enabled zones 1-32, partitions 3-8
+void dscDecodePanel_0xE6_0x2B(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_ENABLED_ZONES;
+  decoded->partitions = dscPanelData[3];
+  dscDecodePanelZones(decoded, 4, 4, 1);
+}
+#endif
+
+
+#if dscZones > 4
+// Enabled zones 33-64, partitions 1-8
+void dscDecodePanel_0xE6_0x2C(dscDecodedPanel *decoded) {
+  decoded->type = DSC_DECODE_ENABLED_ZONES;
+  decoded->partitions = dscPanelData[3];
+  dscDecodePanelZones(decoded, 4, 4, 33);
+}
+#endif
+
+
+// Date, time, system status messages - partitions 1-8
+void dscDecodePanel_0xEB(dscDecodedPanel *decoded) {
+  dscDecodePanelTime(decoded, 3);
+  decoded->partitions = dscPanelData[2];
+  dscDecodePanelEvent(decoded, dscPanelData[7], dscPanelData[8]);
+}
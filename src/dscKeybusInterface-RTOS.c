@@ -35,7 +35,32 @@ bool IRAM dscValidCRC() {
 }
 
 
-bool IRAM dscRedundantPanelData(byte dscPreviousCmd[], volatile byte dscCurrentCmd[], byte checkedBytes) {
+byte IRAM dscPanelBufferCount() {
+  byte bufferHead = dscPanelBufferHead;
+  byte bufferTail = dscPanelBufferTail;
+  if (bufferHead >= bufferTail) return bufferHead - bufferTail;
+  else return dscPanelBufferSlots - bufferTail + bufferHead;
+}
+
+
+byte dscPanelBufferCapacity() {
+  #if dscBufferAllocate
+  if (dscPanelBuffer == NULL) return 0;
+  #endif
+  return dscPanelBufferSlots - 2;
+}
+
+
+#if dscRedundantDataHash
+uint32_t dscPanelDataHash(const byte dscData[], byte length) {
+  uint32_t hash = dscHashBasis;
+  for (byte i = 0; i < length; i++) hash = dscHashByte(hash, dscData[i]);
+  return hash;
+}
+#endif
+
+
+bool IRAM dscRedundantPanelData(byte dscPreviousCmd[], const volatile byte dscCurrentCmd[], byte checkedBytes) {
   bool redundantData = true;
   for (byte i = 0; i < checkedBytes; i++) {
     if (dscPreviousCmd[i] != dscCurrentCmd[i]) {
@@ -54,6 +79,7 @@ bool IRAM dscRedundantPanelData(byte dscPreviousCmd[], volatile byte dscCurrentC
 // Called as an interrupt when the DSC clock changes to write data for virtual keypad and setup timers to read
 // data after an interval.
 void IRAM dscClockInterrupt(uint8_t dscIsrPin) {
+  dscIsrProfileStart(DSC_ISR_CLOCK);
 
   // Sets up a timer that will call dscDataInterrupt() in 250us to read the data line.
   // Data sent from the panel and keypads/modules has latency after a clock change (observed up to 160us for keypad data).
@@ -64,6 +90,9 @@ void IRAM dscClockInterrupt(uint8_t dscIsrPin) {
   if (digitalRead(dscClockPin) == HIGH) {
     if (dscVirtualKeypad) digitalWrite(dscWritePin, LOW);  // Restores the data line after a virtual keypad write
     dscPreviousClockHighTime = micros();
+    #if dscLatencyStats
+    dscIsrEdgeCycles = dscCycleCount();
+    #endif
   }
 
   else {
@@ -74,25 +103,36 @@ void IRAM dscClockInterrupt(uint8_t dscIsrPin) {
 
       static bool writeStart = false;
       static bool writeRepeat = false;
-      static bool writeCmd = false;
 
-      if (dscWritePartition <= 4 && dscStatusCmd == 0x05) writeCmd = true;
-      else if (dscWritePartition > 4 && dscStatusCmd == 0x1B) writeCmd = true;
-      else writeCmd = false;
+      // Loads the next queued key of each partition once its previous key is written - the key is written at the next
+      // status command for its partition, or the current status command if its position is still ahead
+      #if dscWritePipeline
+      dscLoadKeys(writeRepeat);
+      #else
+      static bool writeCmd = false;
+      writeCmd = (dscStatusCmd == dscWriteStatusCmd);
+      #endif
 
       // Writes a F/A/P alarm key and repeats the key on the next immediate command from the panel (0x1C verification)
       if ((dscWriteAlarm && dscPanelKeyPending) || writeRepeat) {
 
         // Writes the first bit by shifting the alarm key data right 7 bits and checking bit 0
         if (dscIsrPanelBitTotal == 1) {
+          dscIsrProfilePath(DSC_ISR_WRITE);
           if (!((dscPanelKey >> 7) & 0x01)) {
             digitalWrite(dscWritePin, HIGH);
           }
           writeStart = true;  // Resolves a timing issue where some writes do not begin at the correct bit
+          #if dscWritePipeline
+          dscWriteEchoBit = 1;
+          dscWriteEchoPartition = dscWriteAlarmPartition;
+          dscWriteEchoLast = writeRepeat;  // The alarm key is verified after the repeat
+          #endif
         }
 
         // Writes the remaining alarm key data
         else if (writeStart && dscIsrPanelBitTotal > 1 && dscIsrPanelBitTotal <= 8) {
+          dscIsrProfilePath(DSC_ISR_WRITE);
           if (!((dscPanelKey >> (8 - dscIsrPanelBitTotal)) & 0x01)) digitalWrite(dscWritePin, HIGH);
 
           // Resets counters when the write is complete
@@ -108,17 +148,51 @@ void IRAM dscClockInterrupt(uint8_t dscIsrPin) {
         }
       }
 
+      #if dscWritePipeline
+      // Writes the key of the partition with its write position at the current byte of the status command, unless
+      // waiting for the panel to respond to a '*' key from the partition
+      else {
+        byte writeBit;
+        byte partitionIndex = dscWriteSlot(dscIsrPanelByteCount, &writeBit);
+        if (partitionIndex < dscPartitions) {
+          dscKeyQueue *queue = &dscKeyFifo[partitionIndex];
+          if (queue->pending && !queue->asterisk && !(queue->flags & dscKeyAlarm)) {
+
+            // Writes the first bit by shifting the key data right 7 bits and checking bit 0
+            if (dscIsrPanelBitTotal == writeBit) {
+              dscIsrProfilePath(DSC_ISR_WRITE);
+              if (!((queue->key >> 7) & 0x01)) digitalWrite(dscWritePin, HIGH);
+              writeStart = true;  // Resolves a timing issue where some writes do not begin at the correct bit
+              dscWriteEchoBit = writeBit;
+              dscWriteEchoPartition = partitionIndex + 1;
+              dscWriteEchoLast = true;
+            }
+
+            // Writes the remaining key data
+            else if (writeStart && dscIsrPanelBitTotal > writeBit && dscIsrPanelBitTotal <= writeBit + 7) {
+              dscIsrProfilePath(DSC_ISR_WRITE);
+              if (!((queue->key >> (7 - dscIsrPanelBitCount)) & 0x01)) digitalWrite(dscWritePin, HIGH);
+
+              // Resets counters when the write is complete - dscVerifyKey() completes the key after it is read back
+              if (dscIsrPanelBitTotal == writeBit + 7) writeStart = false;
+            }
+          }
+        }
+      }
+      #else
       // Writes a regular key unless waiting for a response to the '*' key or the panel is sending a query command
       else if (dscPanelKeyPending && !dscWroteAsterisk && dscIsrPanelByteCount == dscWriteByte && writeCmd) {
 
         // Writes the first bit by shifting the key data right 7 bits and checking bit 0
         if (dscIsrPanelBitTotal == dscWriteBit) {
+          dscIsrProfilePath(DSC_ISR_WRITE);
           if (!((dscPanelKey >> 7) & 0x01)) digitalWrite(dscWritePin, HIGH);
           writeStart = true;  // Resolves a timing issue where some writes do not begin at the correct bit
         }
 
         // Writes the remaining alarm key data
         else if (writeStart && dscIsrPanelBitTotal > dscWriteBit && dscIsrPanelBitTotal <= dscWriteBit + 7) {
+          dscIsrProfilePath(DSC_ISR_WRITE);
           if (!((dscPanelKey >> (7 - dscIsrPanelBitCount)) & 0x01)) digitalWrite(dscWritePin, HIGH);
 
           // Resets counters when the write is complete
@@ -129,14 +203,18 @@ void IRAM dscClockInterrupt(uint8_t dscIsrPin) {
           }
         }
       }
+      #endif
     }
   }
+
+  dscIsrProfileEnd();
 }
 
 
 // Timer interrupt called by dscClockInterrupt() after 250us to read the data line
 // Data sent from the panel and keypads/modules has latency after a clock change (observed up to 160us for keypad data).
 void IRAM dscDataInterrupt(void *arg) {
+  dscIsrProfileStart(DSC_ISR_PANEL);
 
   // Stops the timer
   timer_set_run(FRC1, false);
@@ -170,6 +248,9 @@ void IRAM dscDataInterrupt(void *arg) {
         }
 
         // Stores the stop bit by itself in byte 1 - this aligns the Keybus bytes with dscPanelData[] bytes
+        #if dscRedundantDataHash
+        dscIsrPanelHash = dscHashByte(dscIsrPanelHash, dscIsrPanelData[dscIsrPanelByteCount]);
+        #endif
         dscIsrPanelBitCount = 0;
         dscIsrPanelByteCount++;
       }
@@ -181,6 +262,9 @@ void IRAM dscDataInterrupt(void *arg) {
 
       // Byte is complete, set the counters for the next byte
       else {
+        #if dscRedundantDataHash
+        dscIsrPanelHash = dscHashByte(dscIsrPanelHash, dscIsrPanelData[dscIsrPanelByteCount]);
+        #endif
         dscIsrPanelBitCount = 0;
         dscIsrPanelByteCount++;
       }
@@ -192,9 +276,22 @@ void IRAM dscDataInterrupt(void *arg) {
   // Keypads and modules send data while the clock is low
   else {
     static bool moduleDataDetected = false;
+    dscIsrProfilePath(DSC_ISR_MODULE);
+
+    // Reads back the key written by dscClockInterrupt() from the data line
+    #if dscWritePipeline
+    if (dscWriteEchoBit > 0 && dscIsrPanelBitTotal >= dscWriteEchoBit) {
+      dscWriteEcho <<= 1;
+      if (digitalRead(dscReadPin) == HIGH) dscWriteEcho |= 1;
+      if (dscIsrPanelBitTotal == dscWriteEchoBit + 7) {
+        dscWriteEchoBit = 0;
+        dscVerifyKey();
+      }
+    }
+    #endif
 
-    // Keypad and module data is not buffered and skipped if the panel data buffer is filling
-    if (dscProcessModuleData && dscIsrModuleByteCount < dscReadSize && dscPanelBufferLength <= 1) {
+    // Keypad and module data is captured in place in the head slot of the module buffer
+    if (dscProcessModuleData && dscIsrModuleByteCount < dscReadSize) {
 
       // Data is captured in each byte by shifting left by 1 bit and writing to bit 0
       if (dscIsrModuleBitCount < 8) {
@@ -228,11 +325,31 @@ void IRAM dscDataInterrupt(void *arg) {
 
     // Saves data and resets counters after the clock cycle is complete (high for at least 1ms)
     if (dscClockHighTime > 1000) {
+      dscIsrProfilePath(DSC_ISR_COMMIT);
       dscKeybusTime = millis();
 
       // Skips incomplete and redundant data from status commands - these are sent constantly on the keybus at a high
       // rate, so they are always skipped.  Checking is required in the ISR to prevent flooding the buffer.
+      dscHealth.panelFrames++;
+      #if dscRedundantDataHash
+      if (dscIsrPanelBitCount > 0) dscIsrPanelHash = dscHashByte(dscIsrPanelHash, dscIsrPanelData[dscIsrPanelByteCount]);  // Partial trailing byte
+      dscIsrPanelHash = dscHashByte(dscIsrPanelHash, dscIsrPanelBitTotal);
+      #endif
       if (dscIsrPanelBitTotal < 8) skipData = true;
+      #if dscRedundantDataHash
+      else switch (dscIsrPanelData[0]) {
+        static uint32_t dscPreviousHash05, dscPreviousHash1B;
+        case 0x05:  // Status: partitions 1-4
+          if (dscIsrPanelHash == dscPreviousHash05) skipData = true;
+          else dscPreviousHash05 = dscIsrPanelHash;
+          break;
+
+        case 0x1B:  // Status: partitions 5-8
+          if (dscIsrPanelHash == dscPreviousHash1B) skipData = true;
+          else dscPreviousHash1B = dscIsrPanelHash;
+          break;
+      }
+      #else
       else switch (dscIsrPanelData[0]) {
         static byte dscPreviousCmd05[dscReadSize];
         static byte dscPreviousCmd1B[dscReadSize];
@@ -244,15 +361,43 @@ void IRAM dscDataInterrupt(void *arg) {
           if (dscRedundantPanelData(dscPreviousCmd1B, dscIsrPanelData, dscIsrPanelByteCount)) skipData = true;
           break;
       }
+      #endif
 
-      // Stores new panel data in the panel buffer
+      // Publishes the command captured in the head slot of the panel buffer - the head is advanced only after the
+      // command is complete so dscPanelLoop() never reads a partially written slot
       dscCurrentCmd = dscIsrPanelData[0];
-      if (dscPanelBufferLength == dscBufferSize) dscBufferOverflow = true;
-      else if (!skipData && dscPanelBufferLength < dscBufferSize) {
-        for (byte i = 0; i < dscReadSize; i++) dscPanelBuffer[dscPanelBufferLength][i] = dscIsrPanelData[i];
-        dscPanelBufferBitCount[dscPanelBufferLength] = dscIsrPanelBitTotal;
-        dscPanelBufferByteCount[dscPanelBufferLength] = dscIsrPanelByteCount;
-        dscPanelBufferLength++;
+      if (skipData) dscHealth.filteredFrames++;
+      else {
+        byte bufferHead = dscPanelBufferHead;
+        byte nextHead = bufferHead + 1;
+        if (nextHead == dscPanelBufferSlots) nextHead = 0;
+
+        if (nextHead == dscPanelBufferRelease) {  // Drops the command and reuses the slot
+          dscBufferOverflow = true;
+          dscTraceOverflow = true;
+          dscHealth.overflowFrames++;
+          #if dscBufferAllocate
+          if (dscPanelBufferReserve > 0) dscPanelBufferGrow = true;
+          #endif
+        }
+        else {
+          dscPanelBuffer[bufferHead].bitCount = dscIsrPanelBitTotal;
+          dscPanelBuffer[bufferHead].byteCount = dscIsrPanelByteCount;
+          dscPanelBuffer[bufferHead].time = micros();
+          #if dscRedundantDataHash
+          dscPanelBuffer[bufferHead].hash = dscIsrPanelHash;
+          #endif
+          #if dscLatencyStats
+          dscPanelBuffer[bufferHead].edgeCycles = dscIsrEdgeCycles;
+          dscPanelBuffer[bufferHead].cycles = dscCycleCount();
+          #endif
+          dscMemoryBarrier();
+          dscPanelBufferHead = nextHead;
+          dscIsrPanelData = dscPanelBuffer[nextHead].data;
+
+          byte bufferCount = dscPanelBufferCount();
+          if (bufferCount > dscHealth.bufferHighWater) dscHealth.bufferHighWater = bufferCount;
+        }
       }
 
       // Resets the panel capture data and counters
@@ -260,17 +405,35 @@ void IRAM dscDataInterrupt(void *arg) {
       dscIsrPanelBitTotal = 0;
       dscIsrPanelBitCount = 0;
       dscIsrPanelByteCount = 0;
+      #if dscRedundantDataHash
+      dscIsrPanelHash = dscHashBasis;
+      #endif
       skipData = false;
 
       if (dscProcessModuleData) {
 
-        // Stores new keypad and module data - this data is not buffered
+        // Publishes new keypad and module data with the panel command it responded to
         if (moduleDataDetected) {
           moduleDataDetected = false;
-          dscModuleDataCaptured = true;  // Sets a flag for dscHandleModule()
-          for (byte i = 0; i < dscReadSize; i++) dscModuleData[i] = dscIsrModuleData[i];
-          dscModuleBitCount = dscIsrModuleBitTotal;
-          dscModuleByteCount = dscIsrModuleByteCount;
+          byte bufferHead = dscModuleBufferHead;
+          byte nextHead = bufferHead + 1;
+          if (nextHead == dscModuleBufferSlots) nextHead = 0;
+
+          dscHealth.moduleFrames++;
+          if (nextHead == dscModuleBufferRelease) {  // Drops the response and reuses the slot
+            dscBufferOverflow = true;
+            dscTraceOverflow = true;
+            dscHealth.moduleOverflows++;
+          }
+          else {
+            dscModuleBuffer[bufferHead].bitCount = dscIsrModuleBitTotal;
+            dscModuleBuffer[bufferHead].byteCount = dscIsrModuleByteCount;
+            dscModuleBuffer[bufferHead].panelCommand = dscCurrentCmd;
+            dscModuleBuffer[bufferHead].time = micros();
+            dscMemoryBarrier();
+            dscModuleBufferHead = nextHead;
+            dscIsrModuleData = dscModuleBuffer[nextHead].data;
+          }
         }
 
         // Resets the keypad and module capture data and counters
@@ -281,24 +444,25 @@ void IRAM dscDataInterrupt(void *arg) {
       }
 
       // Notifies the dscPanelLoop task when new data is available
-      if (dscPanelBufferLength > 0) {
-        BaseType_t xHigherPriorityTaskWoken;
-        vTaskNotifyGiveFromISR(dscPanelLoopHandle, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) portYIELD();
-      }
-      else if (dscModuleDataCaptured) xSemaphoreGive(dscDataAvailable);
+      BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+      if (dscPanelBufferHead != dscPanelBufferTail) vTaskNotifyGiveFromISR(dscPanelLoopHandle, &xHigherPriorityTaskWoken);
+      else if (dscModuleBufferHead != dscModuleBufferTail) xSemaphoreGiveFromISR(dscDataAvailable, &xHigherPriorityTaskWoken);
+      if (xHigherPriorityTaskWoken) portYIELD();
     }
   }
+
+  dscIsrProfileEnd();
 }
 
 
-void dscBegin() {
+bool dscBegin() {
 
   // Settings
   if (dscWritePin == 255) dscVirtualKeypad = false;
   else dscVirtualKeypad = true;
   dscPanelKeyPending = false;
   dscWritePartition = 1;
+  dscSetWritePosition(dscWritePartition);
   dscPauseStatus = false;
 
   // GPIO setup
@@ -306,14 +470,157 @@ void dscBegin() {
   gpio_enable(dscReadPin, GPIO_INPUT);
   gpio_enable(dscWritePin, GPIO_OUTPUT);
 
-  // Task setup
+  // Semaphore setup - created before the panel buffer so the public API never sees a NULL handle
   dscDataAvailable = xSemaphoreCreateBinary();
+  dscPanelDataReleased = xSemaphoreCreateBinary();
+  dscStatusMutex = xSemaphoreCreateMutex();
+  dscWriteMutex = xSemaphoreCreateMutex();
+
+  // Panel buffer setup
+  #if dscBufferAllocate
+  if (dscPanelBufferFrames == 0) dscPanelBufferFrames = dscBufferSize;
+  if (dscPanelBufferFrames > 253) dscPanelBufferFrames = 253;
+  if (dscPanelBufferReserve > 253 - dscPanelBufferFrames) dscPanelBufferReserve = 253 - dscPanelBufferFrames;
+  dscPanelBufferSlots = dscPanelBufferFrames + 2;
+  dscPanelBuffer = calloc(dscPanelBufferSlots, sizeof(dscFrame));
+  if (dscPanelBuffer == NULL) {
+    printf("\ndscKeybusInterface is unable to allocate the panel buffer.\n\n");
+    return false;
+  }
+  #endif
+  dscIsrPanelData = dscPanelBuffer[dscPanelBufferHead].data;
+  dscIsrModuleData = dscModuleBuffer[dscModuleBufferHead].data;
+  #if dscRedundantDataHash
+  dscIsrPanelHash = dscHashBasis;
+  #endif
+  #if dscIsrProfile
+  dscIsrProfileSecond = sdk_system_get_cpu_freq() * 1000000UL;
+  dscIsrProfileWindowStart = dscCycleCount();
+  #endif
+
+  // Task setup
   xTaskCreate(dscPanelLoop, "dscPanelLoop", 384, NULL, 1, NULL);
 
   printf("\ndscKeybusInterface is online.\n\n");
+  return true;
 }
 
 
+/*
+ *  Panel command descriptors, indexed by the command byte.  The tables are const and stored in flash - each field is
+ *  32 bits so entries are read with aligned loads.  Commands without an entry are printed as unrecognized data.
+ *
+ *  Processors and printers for commands that only carry partitions or zones beyond dscPartitions and dscZones are
+ *  compiled out with their strings - these commands are printed as unrecognized data.
+ */
+#if dscPartitions > 2
+#define dscPartitions3to8(handler) handler  // Commands only processed or printed for partitions 3-8
+#else
+#define dscPartitions3to8(handler) NULL
+#endif
+
+#if dscPartitions > 4
+#define dscPartitions5to8(handler) handler
+#else
+#define dscPartitions5to8(handler) NULL
+#endif
+
+#if dscZones > 1
+#define dscZones9to16(handler) handler      // Commands only processed or printed for zones 9-64
+#else
+#define dscZones9to16(handler) NULL
+#endif
+
+#if dscZones > 2
+#define dscZones17to24(handler) handler
+#else
+#define dscZones17to24(handler) NULL
+#endif
+
+#if dscZones > 3
+#define dscZones25to32(handler) handler
+#else
+#define dscZones25to32(handler) NULL
+#endif
+
+#if dscZones > 4
+#define dscZones33to40(handler) handler
+#else
+#define dscZones33to40(handler) NULL
+#endif
+
+#if dscZones > 5
+#define dscZones41to48(handler) handler
+#else
+#define dscZones41to48(handler) NULL
+#endif
+
+#if dscZones > 6
+#define dscZones49to56(handler) handler
+#else
+#define dscZones49to56(handler) NULL
+#endif
+
+#if dscZones > 7
+#define dscZones57to64(handler) handler
+#else
+#define dscZones57to64(handler) NULL
+#endif
+
+const dscCommand dscPanelCommands[256] = {
+  [0x05] = { dscProcessPanelStatus, dscPrintPanel_0x05, dscDecodePanel_0x05, 0 },                                                                     // Panel status: partitions 1-4
+  [0x0A] = { NULL, dscPrintPanel_0x0A, dscDecodePanel_0x0A, dscCmdRedundant | dscCmdCRC | dscCmdSlot(dscHistory0A) },                                 // Panel status in alarm/programming, partitions 1-4
+  [0x11] = { NULL, dscPrintPanel_0x11, dscDecodePanelQuery, dscCmdPeriodic | dscCmdSlot(dscHistory11) },                                              // Keypad slot query
+  [0x16] = { NULL, dscPrintPanel_0x16, dscDecodePanel_0x16, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory16) },                                  // Zone wiring
+  [0x1B] = { dscProcessPanelStatus, dscPartitions5to8(dscPrintPanel_0x1B), dscPartitions5to8(dscDecodePanel_0x1B), 0 },                               // Panel status: partitions 5-8
+  [0x1C] = { NULL, dscPrintPanel_0x1C, dscDecodePanelQuery, 0 },                                                                                      // Verify keypad Fire/Auxiliary/Panic
+  [0x27] = { dscProcessPanel_0x27, dscPrintPanel_0x27, dscDecodePanel_0x27, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory27) },                  // Panel status and zones 1-8 status
+  [0x28] = { NULL, dscPrintPanel_0x28, dscDecodePanelQuery, 0 },                                                                                      // Zone expander query
+  [0x2D] = { dscZones9to16(dscProcessPanel_0x2D), dscPrintPanel_0x2D, dscDecodePanel_0x2D, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory2D) },   // Panel status and zones 9-16 status
+  [0x34] = { dscZones17to24(dscProcessPanel_0x34), dscPrintPanel_0x34, dscDecodePanel_0x34, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory34) },  // Panel status and zones 17-24 status
+  [0x3E] = { dscZones25to32(dscProcessPanel_0x3E), dscPrintPanel_0x3E, dscDecodePanel_0x3E, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory3E) },  // Panel status and zones 25-32 status
+  [0x4C] = { NULL, dscPrintPanel_0x4C, dscDecodePanelQuery, 0 },                                                                                      // Unknown Keybus query
+  [0x58] = { NULL, dscPrintPanel_0x58, dscDecodePanelQuery, 0 },                                                                                      // Unknown Keybus query
+  [0x5D] = { NULL, dscPrintPanel_0x5D, dscDecodePanel_0x5D, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory5D) },                                  // Flash panel lights: status and zones 1-32, partition 1
+  [0x63] = { NULL, dscPrintPanel_0x63, dscDecodePanel_0x63, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistory63) },                                  // Flash panel lights: status and zones 1-32, partition 2
+  [0x64] = { NULL, dscPrintPanel_0x64, dscDecodePanel_0x64, dscCmdCRC | dscCmdRepeat },                                                               // Beep - one-time, partition 1
+  [0x69] = { NULL, dscPrintPanel_0x69, dscDecodePanel_0x69, dscCmdCRC | dscCmdRepeat },                                                               // Beep - one-time, partition 2
+  [0x75] = { NULL, dscPrintPanel_0x75, dscDecodePanel_0x75, dscCmdCRC | dscCmdRepeat },                                                               // Beep pattern - repeated, partition 1
+  [0x7A] = { NULL, dscPrintPanel_0x7A, dscDecodePanel_0x7A, dscCmdCRC | dscCmdRepeat },                                                               // Beep pattern - repeated, partition 2
+  [0x7F] = { NULL, dscPrintPanel_0x7F, dscDecodePanel_0x7F, dscCmdCRC | dscCmdRepeat },                                                               // Beep - one-time long beep, partition 1
+  [0x82] = { NULL, dscPrintPanel_0x82, dscDecodePanel_0x82, dscCmdCRC | dscCmdRepeat },                                                               // Beep - one-time long beep, partition 2
+  [0x87] = { NULL, dscPrintPanel_0x87, dscDecodePanel_0x87, dscCmdCRC },                                                                              // Panel outputs
+  [0x8D] = { NULL, dscPrintPanel_0x8D, dscDecodePanelMessage, dscCmdCRC },                                                                            // User code programming key response, codes 17-32
+  [0x94] = { NULL, dscPrintPanel_0x94, dscDecodePanel_0x94, 0 },                                                                                      // Unknown - immediate after entering *5 programming
+  [0xA5] = { dscProcessPanel_0xA5, dscPrintPanel_0xA5, dscDecodePanel_0xA5, dscCmdCRC },                                                              // Date, time, system status messages - partitions 1-2
+  [0xB1] = { NULL, dscPrintPanel_0xB1, dscDecodePanel_0xB1, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistoryB1) },                                  // Enabled zones 1-32
+  [0xBB] = { NULL, dscPrintPanel_0xBB, dscDecodePanel_0xBB, dscCmdCRC },                                                                              // Bell
+  [0xC3] = { NULL, dscPrintPanel_0xC3, dscDecodePanel_0xC3, dscCmdPeriodic | dscCmdCRC | dscCmdSlot(dscHistoryC3) },                                  // Keypad status
+  [0xCE] = { NULL, dscPrintPanel_0xCE, dscDecodePanel_0xCE, dscCmdCRC },                                                                              // Unknown command
+  [0xD5] = { NULL, dscPrintPanel_0xD5, dscDecodePanelQuery, 0 },                                                                                      // Keypad zone query
+  [0xE6] = { NULL, dscPrintPanel_0xE6, NULL, dscCmdExtended | dscCmdCRC },                                                                            // Extended status commands: partitions 3-8, zones 33-64
+  [0xEB] = { dscPartitions3to8(dscProcessPanel_0xEB), dscPrintPanel_0xEB, dscDecodePanel_0xEB, dscCmdCRC },                                           // Date, time, system status messages - partitions 1-8
+};
+
+// 0xE6 extended status commands, indexed by the subcommand in byte 2
+const dscCommand dscPanelCommandsE6[256] = {
+  [0x03] = { NULL, dscPartitions5to8(dscPrintPanel_0xE6_0x03), dscPartitions5to8(dscDecodePanel_0xE6_0x03), dscCmdRedundant | dscCmdCRC | dscCmdBytes(8) | dscCmdSlot(dscHistoryE6_03) },  // Status in alarm/programming, partitions 5-8
+  [0x09] = { dscPartitions3to8(dscZones33to40(dscProcessPanel_0xE6_0x09)), dscZones33to40(dscPrintPanel_0xE6_0x09), dscZones33to40(dscDecodePanel_0xE6_0x09), dscCmdCRC },                 // Zones 33-40 status
+  [0x0B] = { dscPartitions3to8(dscZones41to48(dscProcessPanel_0xE6_0x0B)), dscZones41to48(dscPrintPanel_0xE6_0x0B), dscZones41to48(dscDecodePanel_0xE6_0x0B), dscCmdCRC },                 // Zones 41-48 status
+  [0x0D] = { dscPartitions3to8(dscZones49to56(dscProcessPanel_0xE6_0x0D)), dscZones49to56(dscPrintPanel_0xE6_0x0D), dscZones49to56(dscDecodePanel_0xE6_0x0D), dscCmdCRC },                 // Zones 49-56 status
+  [0x0F] = { dscPartitions3to8(dscZones57to64(dscProcessPanel_0xE6_0x0F)), dscZones57to64(dscPrintPanel_0xE6_0x0F), dscZones57to64(dscDecodePanel_0xE6_0x0F), dscCmdCRC },                 // Zones 57-64 status
+  [0x17] = { NULL, dscPrintPanel_0xE6_0x17, dscDecodePanel_0xE6_0x17, dscCmdCRC },                                                                                                         // Flash panel lights: status and zones 1-32, partitions 1-8
+  [0x18] = { NULL, dscZones33to40(dscPrintPanel_0xE6_0x18), dscZones33to40(dscDecodePanel_0xE6_0x18), dscCmdCRC },                                                                         // Flash panel lights: status and zones 33-64, partitions 1-8
+  [0x19] = { NULL, dscPartitions3to8(dscPrintPanel_0xE6_0x19), dscPartitions3to8(dscDecodePanel_0xE6_0x19), dscCmdCRC | dscCmdRepeat },                                                    // Beep - one-time, partitions 3-8
+  [0x1A] = { NULL, dscPrintPanel_0xE6_0x1A, dscDecodePanelMessage, dscCmdCRC },                                                                                                            // Unknown command
+  [0x1D] = { NULL, dscPartitions3to8(dscPrintPanel_0xE6_0x1D), dscPartitions3to8(dscDecodePanel_0xE6_0x1D), dscCmdCRC | dscCmdRepeat },                                                    // Beep pattern, partitions 3-8
+  [0x20] = { NULL, dscPrintPanel_0xE6_0x20, dscDecodePanel_0xE6_0x20, dscCmdRedundant | dscCmdCRC | dscCmdSlot(dscHistoryE6_20) },                                                         // Status in programming, zone lights 33-64
+  [0x2B] = { NULL, dscPartitions3to8(dscPrintPanel_0xE6_0x2B), dscPartitions3to8(dscDecodePanel_0xE6_0x2B), dscCmdCRC },                                                                   // Enabled zones 1-32, partitions 3-8
+  [0x2C] = { NULL, dscZones33to40(dscPrintPanel_0xE6_0x2C), dscZones33to40(dscDecodePanel_0xE6_0x2C), dscCmdCRC },                                                                         // Enabled zones 33-64, partitions 3-8
+  [0x41] = { NULL, dscPrintPanel_0xE6_0x41, dscDecodePanel_0xE6_0x41, dscCmdCRC },                                                                                                         // Status in access code programming, zone lights 65-95
+};
+
+
 void IRAM dscPanelLoop() {
 
   // Timer interrupt setup
@@ -331,197 +638,760 @@ void IRAM dscPanelLoop() {
 
   while(1) {
 
-    // Waits until notification from dscDataInterrupt() that new data is available
-    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-
+    // Waits until notification from dscDataInterrupt() that new data is available - commands that arrived while
+    // processing are drained first without waiting.  The wait times out every second without data to check if the
+    // Keybus is disconnected.
+    if (dscPanelBufferTail == dscPanelBufferHead) {
+      if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)) == 0) {
+        xSemaphoreTake(dscStatusMutex, portMAX_DELAY);
+        bool keybusChanged = dscCheckKeybus();
+        xSemaphoreGive(dscStatusMutex);
+        if (keybusChanged) xSemaphoreGive(dscDataAvailable);
+        continue;
+      }
+      if (dscPanelBufferTail == dscPanelBufferHead) continue;  // Notification for a command already drained
+    }
 
-    // Checks if Keybus data is detected and sets a status flag if data is not detected for 3s
-    taskENTER_CRITICAL();
-    if (millis() - dscKeybusTime > 3000) dscKeybusConnected = false;  // dataTime is set in dscDataInterrupt() when the clock resets
-    else dscKeybusConnected = true;
-    taskEXIT_CRITICAL();
+    // Holds the status while it is updated so dscSnapshot() never copies a partially processed command
+    xSemaphoreTake(dscStatusMutex, portMAX_DELAY);
 
-    if (dscPreviousKeybus != dscKeybusConnected) {
-      dscPreviousKeybus = dscKeybusConnected;
-      dscKeybusChanged = true;
-      if (!dscPauseStatus) dscStatusChanged = true;
-      if (!dscKeybusConnected) continue;
+    if (dscCheckKeybus() && !dscKeybusConnected) {
+      xSemaphoreGive(dscStatusMutex);
+      continue;
     }
 
-    // Copies data from the buffer to dscPanelData[]
-    static byte dscPanelBufferIndex = 1;
-    byte dataIndex = dscPanelBufferIndex - 1;
-    for (byte i = 0; i < dscReadSize; i++) dscPanelData[i] = dscPanelBuffer[dataIndex][i];
-    dscPanelBitCount = dscPanelBufferBitCount[dataIndex];
-    dscPanelByteCount = dscPanelBufferByteCount[dataIndex];
-    dscPanelBufferIndex++;
-
-    // Resets counters when the buffer is cleared
-    taskENTER_CRITICAL();
-    if (dscPanelBufferIndex > dscPanelBufferLength) {
-      dscPanelBufferIndex = 1;
-      dscPanelBufferLength = 0;
-    }
-    taskEXIT_CRITICAL();
+    #if dscBufferAllocate
+    if (dscPanelBufferRetired != NULL) dscFreeRetiredBuffer();
+    if (dscPanelBufferGrow) dscGrowPanelBuffer();
+    #endif
+
+    // Points dscPanelData to the command at the tail of the buffer and releases the previous command to dscDataInterrupt()
+    byte bufferTail = dscPanelBufferTail;
+    dscPanelFrame = &dscPanelBuffer[bufferTail];
+    dscPanelData = dscPanelFrame->data;
+    dscPanelBitCount = dscPanelFrame->bitCount;
+    dscPanelByteCount = dscPanelFrame->byteCount;
+    dscMemoryBarrier();
+    dscPanelBufferRelease = bufferTail;
+    if (++bufferTail == dscPanelBufferSlots) bufferTail = 0;
+    dscPanelBufferTail = bufferTail;
+    #if dscLatencyStats
+    uint32_t readCycles = dscCycleCount();
+    #endif
+
+    if (dscTraceQueue != NULL) dscTraceFrame(dscPanelData, dscPanelBitCount, dscPanelByteCount, dscPanelFrame->time, 0, 0);
+
+    // Skips startup, redundant, and unprocessed data
+    bool panelDataAvailable = dscProcessPanelCommand();
+    xSemaphoreGive(dscStatusMutex);
+    #if dscLatencyStats
+    dscLatencyFrame(dscPanelFrame, readCycles, panelDataAvailable);
+    #endif
+    if (!panelDataAvailable) continue;
+
+    dscPanelDataAvailable = true;
+    xSemaphoreGive(dscDataAvailable);
+    #if dscBufferAllocate
+    if (dscPanelBufferRetired != NULL) dscPanelBufferRetiredGiven = true;
+    #endif
+
+    // Waits for the sketch to finish with dscPanelData before the next command can be processed
+    if (dscRetainPanelData) xSemaphoreTake(dscPanelDataReleased, portMAX_DELAY);
+  }
+}
+
+
+// Checks if Keybus data is detected and sets a status flag if data is not detected for 3s, returns true if the
+// status changed
+bool dscCheckKeybus() {
+  if (millis() - dscKeybusTime > 3000) dscKeybusConnected = false;  // dscKeybusTime is set in dscDataInterrupt() when the clock resets
+  else dscKeybusConnected = true;
+
+  if (dscPreviousKeybus == dscKeybusConnected) return false;
+  dscPreviousKeybus = dscKeybusConnected;
+  dscKeybusChanged = true;
+  dscEmitEvent(DSC_EVENT_KEYBUS, 0, dscKeybusConnected);
+  if (!dscPauseStatus) dscStatusChanged = true;
+  if (!dscKeybusConnected) dscHealth.keybusDisconnects++;
+  return true;
+}
+
+
+#if dscBufferAllocate
+// Grows the panel buffer by dscPanelBufferReserve commands after the first overflow.  Called by dscPanelLoop() before
+// it moves to the next command.  The waiting commands are complete and only read by dscPanelLoop(), so they are copied
+// with interrupts enabled - only the commands completed during the copy, the command being captured, and the pointer
+// swap are done with interrupts disabled.  The previous buffer is kept until the sketch is done with dscPanelData.
+void dscGrowPanelBuffer() {
+  dscPanelBufferGrow = false;
+  byte slots = dscPanelBufferSlots + dscPanelBufferReserve;
+  dscPanelBufferReserve = 0;
+  dscFrame *buffer = malloc(slots * sizeof(dscFrame));
+  if (buffer == NULL) return;
+
+  dscFrame *previousBuffer = dscPanelBuffer;
+  byte previousSlots = dscPanelBufferSlots;
+  byte slot = dscPanelBufferTail;
+  byte bufferHead = dscPanelBufferHead;
+  byte count = 0;
+  while (slot != bufferHead) {
+    buffer[count++] = previousBuffer[slot];
+    if (++slot == previousSlots) slot = 0;
+  }
+
+  taskENTER_CRITICAL();
+  while (slot != dscPanelBufferHead) {
+    buffer[count++] = previousBuffer[slot];
+    if (++slot == previousSlots) slot = 0;
+  }
+  buffer[count] = previousBuffer[slot];
+  dscPanelBuffer = buffer;
+  dscPanelBufferSlots = slots;
+  dscPanelBufferTail = 0;
+  dscPanelBufferHead = count;
+  dscPanelBufferRelease = slots - 1;
+  dscIsrPanelData = buffer[count].data;
+  taskEXIT_CRITICAL();
+
+  // The sketch has already released dscPanelData if dscRetainPanelData is set
+  if (dscRetainPanelData) free(previousBuffer);
+  else {
+    dscPanelBufferRetired = previousBuffer;
+    dscPanelBufferRetiredGiven = false;
+  }
+}
+
+
+// Frees the buffer replaced by dscGrowPanelBuffer() once the sketch has taken dscDataAvailable for a command in the
+// new buffer, and so has finished with any dscPanelData pointer into the previous buffer
+void dscFreeRetiredBuffer() {
+  if (!dscPanelBufferRetiredGiven || uxSemaphoreGetCount(dscDataAvailable) != 0) return;
+  free(dscPanelBufferRetired);
+  dscPanelBufferRetired = NULL;
+}
+#endif
+
+
+// Filters and processes the command in dscPanelData, returns true if the command is new data for the sketch.  Called
+// by dscPanelLoop() for each command in the panel buffer.
+bool dscProcessPanelCommand() {
+
+  // Waits at startup for the 0x05 status command or a command with valid CRC data to eliminate spurious data.
+  static bool firstClockCycle = true;
+  if (firstClockCycle) {
+    if ((dscValidCRC() || dscPanelData[0] == 0x05) && dscPanelData[0] != 0) firstClockCycle = false;
+    else return false;
+  }
 
-    // Waits at startup for the 0x05 status command or a command with valid CRC data to eliminate spurious data.
-    static bool firstClockCycle = true;
-    if (firstClockCycle) {
-      if ((dscValidCRC() || dscPanelData[0] == 0x05) && dscPanelData[0] != 0) firstClockCycle = false;
-      else continue;
+  const dscCommand *command = dscPanelCommand();
+  uint32_t options = command->options;
+
+  // Skips redundant data sent constantly while in installer programming, and redundant data from periodic commands
+  // sent at regular intervals unless dscProcessRedundantData is set
+  byte redundantData = options & dscCmdRedundantMask;
+  #if dscRedundantDataHash
+  if (redundantData == dscCmdRedundant || (redundantData == dscCmdPeriodic && !dscProcessRedundantData)) {
+
+    // Compares the hash calculated by dscDataInterrupt(), or hashes the compared bytes if limited
+    byte checkedBytes = dscCmdGetBytes(options);
+    uint32_t hash = dscPanelFrame->hash;
+    if (checkedBytes != 0) hash = dscPanelDataHash(dscPanelData, checkedBytes);
+
+    uint32_t *previousHash = &dscCommandHistory[dscCmdGetSlot(options)];
+    if (hash == *previousHash) {
+      dscHealth.redundantFrames++;
+      return false;
     }
+    *previousHash = hash;
+  }
 
-    // Skips redundant data sent constantly while in installer programming
-    static byte dscPreviousCmd0A[dscReadSize];
-    static byte dscPreviousCmdE6_20[dscReadSize];
-    switch (dscPanelData[0]) {
-      case 0x0A:  // Status in programming
-        if (dscRedundantPanelData(dscPreviousCmd0A, dscPanelData, dscReadSize)) continue;
-        break;
-
-      case 0xE6:
-        if (dscPanelData[2] == 0x20 && dscRedundantPanelData(dscPreviousCmdE6_20, dscPanelData, dscReadSize)) continue;  // Status in programming, zone lights 33-64
-        break;
+  // Skips any command identical to the last command of the same type - commands are tracked in a small cache indexed
+  // by command and a command that was replaced in the cache is processed
+  else if (redundantData == 0 && dscSkipRedundantCommands && !(options & dscCmdRepeat)) {
+    byte subcommand = 0;
+    if (dscPanelCommands[dscPanelData[0]].options & dscCmdExtended) subcommand = dscPanelData[2];
+    uint16_t cacheCommand = (dscPanelData[0] << 8) | subcommand;
+    byte cacheIndex = (dscPanelData[0] + subcommand * 31) & (dscHashCacheSize - 1);
+
+    if (dscHashCache[cacheIndex].command == cacheCommand && dscHashCache[cacheIndex].hash == dscPanelFrame->hash) {
+      dscHealth.redundantFrames++;
+      return false;
     }
-    if (dscPartitions > 4) {
-      static byte dscPreviousCmdE6_03[dscReadSize];
-      if (dscPanelData[0] == 0xE6 && dscPanelData[2] == 0x03 && dscRedundantPanelData(dscPreviousCmdE6_03, dscPanelData, 8)) continue;  // Status in alarm/programming, partitions 5-8
+    dscHashCache[cacheIndex].command = cacheCommand;
+    dscHashCache[cacheIndex].hash = dscPanelFrame->hash;
+  }
+  #else
+  if (redundantData == dscCmdRedundant || (redundantData == dscCmdPeriodic && !dscProcessRedundantData)) {
+    byte checkedBytes = dscCmdGetBytes(options);
+    if (checkedBytes == 0) checkedBytes = dscReadSize;
+    if (dscRedundantPanelData(dscCommandHistory[dscCmdGetSlot(options)], dscPanelData, checkedBytes)) {
+      dscHealth.redundantFrames++;
+      return false;
     }
+  }
+  #endif
 
-    // Skips redundant data from periodic commands sent at regular intervals, by default this data is processed
-    if (!dscProcessRedundantData) {
-      static byte dscPreviousCmd11[dscReadSize];
-      static byte dscPreviousCmd16[dscReadSize];
-      static byte dscPreviousCmd27[dscReadSize];
-      static byte dscPreviousCmd2D[dscReadSize];
-      static byte dscPreviousCmd34[dscReadSize];
-      static byte dscPreviousCmd3E[dscReadSize];
-      static byte dscPreviousCmd5D[dscReadSize];
-      static byte dscPreviousCmd63[dscReadSize];
-      static byte dscPreviousCmdB1[dscReadSize];
-      static byte dscPreviousCmdC3[dscReadSize];
-      switch (dscPanelData[0]) {
-        case 0x11:  // Keypad slot query
-          if (dscRedundantPanelData(dscPreviousCmd11, dscPanelData, dscReadSize)) continue;
-          break;
+  // Processes valid panel data
+  if ((options & dscCmdCRC) && !dscValidCRC()) dscHealth.crcErrors++;
+  else if (command->process != NULL) command->process();
 
-        case 0x16:  // Zone wiring
-          if (dscRedundantPanelData(dscPreviousCmd16, dscPanelData, dscReadSize)) continue;
-          break;
+  return true;
+}
 
-        case 0x27:  // Status with zone 1-8 info
-          if (dscRedundantPanelData(dscPreviousCmd27, dscPanelData, dscReadSize)) continue;
-          break;
 
-        case 0x2D:  // Status with zone 9-16 info
-          if (dscRedundantPanelData(dscPreviousCmd2D, dscPanelData, dscReadSize)) continue;
-          break;
+// Returns the descriptor for the command in dscPanelData - 0xE6 extended status commands are looked up by subcommand
+const dscCommand* dscPanelCommand() {
+  const dscCommand *command = &dscPanelCommands[dscPanelData[0]];
+  if (command->options & dscCmdExtended) {
+    const dscCommand *subcommand = &dscPanelCommandsE6[dscPanelData[2]];
+    if (subcommand->print != NULL) return subcommand;
+  }
+  return command;
+}
 
-        case 0x34:  // Status with zone 17-24 info
-          if (dscRedundantPanelData(dscPreviousCmd34, dscPanelData, dscReadSize)) continue;
-          break;
+// Adds a status event to the event log if selected by a subscriber, called by the status processors when a status
+// changes.  Events are never dropped at this point: the oldest event is overwritten and each subscriber that had not
+// yet read it detects the overflow on its next dscReadEvent().
+void dscEmitEvent(byte type, byte index, byte state) {
+  if (!(dscEventMask & dscEventBit(type))) return;
+
+  dscEvent *event = &dscEventLog[dscEventLogHead & (dscEventLogSize - 1)];
+  event->type = type;
+  event->index = index;
+  event->state = state;
+  event->time = millis();
+  dscMemoryBarrier();
+  dscEventLogHead++;
+
+  for (byte subscriber = 0; subscriber < dscSubscriberCount; subscriber++) {
+    if (dscEventSubscribers[subscriber].mask & dscEventBit(type)) xTaskNotifyGive(dscEventSubscribers[subscriber].task);
+  }
+}
 
-        case 0x3E:  // Status with zone 25-32 info
-          if (dscRedundantPanelData(dscPreviousCmd3E, dscPanelData, dscReadSize)) continue;
-          break;
 
-        case 0x5D:  // Flash panel lights: status and zones 1-32
-          if (dscRedundantPanelData(dscPreviousCmd5D, dscPanelData, dscReadSize)) continue;
-          break;
+// Subscribes the calling task to the events in mask, starting with the next event.  The subscriber is woken with a
+// task notification, so the task should not use its notification value for anything else.
+int dscSubscribe(uint32_t mask) {
+  taskENTER_CRITICAL();
+  if (dscSubscriberCount >= dscSubscribers) {
+    taskEXIT_CRITICAL();
+    return -1;
+  }
+  byte subscriber = dscSubscriberCount;
+  dscEventSubscribers[subscriber].task = xTaskGetCurrentTaskHandle();
+  dscEventSubscribers[subscriber].mask = mask;
+  dscEventSubscribers[subscriber].cursor = dscEventLogHead;
+  dscEventSubscribers[subscriber].overflow = false;
+  dscMemoryBarrier();
+  dscSubscriberCount++;
+  dscEventMask |= mask;
+  taskEXIT_CRITICAL();
+  return subscriber;
+}
 
-        case 0x63:  // Flash panel lights: status and zones 33-64
-          if (dscRedundantPanelData(dscPreviousCmd63, dscPanelData, dscReadSize)) continue;
-          break;
 
-        case 0xB1:  // Enabled zones 1-32
-          if (dscRedundantPanelData(dscPreviousCmdB1, dscPanelData, dscReadSize)) continue;
-          break;
+// Reads the next event selected by the subscriber mask, waiting up to ticksToWait for one to be available
+bool dscReadEvent(int subscriber, dscEvent *event, TickType_t ticksToWait) {
+  if (subscriber < 0 || subscriber >= dscSubscriberCount) return false;
+  dscSubscriber *reader = &dscEventSubscribers[subscriber];
 
-        case 0xC3:  // Unknown command
-          if (dscRedundantPanelData(dscPreviousCmdC3, dscPanelData, dscReadSize)) continue;
-          break;
+  while (1) {
+    while (reader->cursor != dscEventLogHead) {
+      *event = dscEventLog[reader->cursor & (dscEventLogSize - 1)];
+      dscMemoryBarrier();
+
+      // Skips ahead to the oldest event still in the log if the event was overwritten before or while it was copied
+      uint32_t head = dscEventLogHead;
+      if (head - reader->cursor > dscEventLogSize - 1) {
+        reader->cursor = head - (dscEventLogSize - 1);
+        reader->overflow = true;
+        continue;
       }
-    }
 
-    // Processes valid panel data
-    switch (dscPanelData[0]) {
-      case 0x05:
-      case 0x1B: dscProcessPanelStatus(); break;
-      case 0x27: dscProcessPanel_0x27(); break;
-      case 0x2D: dscProcessPanel_0x2D(); break;
-      case 0x34: dscProcessPanel_0x34(); break;
-      case 0x3E: dscProcessPanel_0x3E(); break;
-      case 0xA5: dscProcessPanel_0xA5(); break;
-      case 0xE6: if (dscPartitions > 2) dscProcessPanel_0xE6(); break;
-      case 0xEB: if (dscPartitions > 2) dscProcessPanel_0xEB(); break;
+      reader->cursor++;
+      if (reader->mask & dscEventBit(event->type)) return true;
     }
 
-    dscPanelDataAvailable = true;
-    xSemaphoreGive(dscDataAvailable);
+    if (ulTaskNotifyTake(pdTRUE, ticksToWait) == 0) return false;
   }
 }
 
 
+void dscReleasePanelData() {
+  if (dscRetainPanelData) xSemaphoreGive(dscPanelDataReleased);
+}
+
+
 bool dscHandleModule() {
-  if (!dscModuleDataCaptured) return false;
-  dscModuleDataCaptured = false;
-
-  if (dscModuleBitCount < 8) return false;
-
-  // Skips periodic keypad slot query responses
-  if (!dscProcessRedundantData) {
-    bool redundantData = true;
-    byte checkedBytes = dscReadSize;
-    static byte dscPreviousSlotData[dscReadSize];
-    for (byte i = 0; i < checkedBytes; i++) {
-      if (dscPreviousSlotData[i] != dscModuleData[i]) {
-        redundantData = false;
-        break;
-      }
-    }
-    if (redundantData) return false;
-    else {
-      for (byte i = 0; i < dscReadSize; i++) dscPreviousSlotData[i] = dscModuleData[i];
-      return true;
+  while (dscModuleBufferTail != dscModuleBufferHead) {
+
+    // Points dscModuleData to the response at the tail of the module buffer and releases the previous response
+    byte bufferTail = dscModuleBufferTail;
+    const dscModuleFrame *moduleFrame = &dscModuleBuffer[bufferTail];
+    dscModuleData = moduleFrame->data;
+    dscModuleBitCount = moduleFrame->bitCount;
+    dscModuleByteCount = moduleFrame->byteCount;
+    dscModuleCmd = moduleFrame->panelCommand;
+    dscMemoryBarrier();
+    dscModuleBufferRelease = bufferTail;
+    if (++bufferTail == dscModuleBufferSlots) bufferTail = 0;
+    dscModuleBufferTail = bufferTail;
+
+    if (dscTraceQueue != NULL) dscTraceFrame(dscModuleData, dscModuleBitCount, dscModuleByteCount, moduleFrame->time, DSC_TRACE_MODULE, dscModuleCmd);
+
+    if (dscModuleBitCount < 8) continue;
+
+    // Skips periodic keypad slot query responses
+    if (!dscProcessRedundantData) {
+      static byte dscPreviousSlotData[dscReadSize];
+      if (dscRedundantPanelData(dscPreviousSlotData, dscModuleData, dscReadSize)) continue;
     }
+
+    return true;
   }
 
-  return true;
+  return false;
+}
+
+
+// Copies the health counters - dscDataInterrupt() updates the counters, so interrupts are disabled for the copy
+void dscHealthSnapshot(dscHealthCounters *counters) {
+  taskENTER_CRITICAL();
+  *counters = dscHealth;
+  taskEXIT_CRITICAL();
+}
+
+
+void dscHealthReset() {
+  taskENTER_CRITICAL();
+  memset(&dscHealth, 0, sizeof(dscHealth));
+  taskEXIT_CRITICAL();
 }
 
 
 // Sets up writes for a single key
 void dscWriteKey(int receivedKey) {
-  while(dscPanelKeyPending || dscPanelKeysPending) vTaskDelay(1);
+  xSemaphoreTake(dscWriteMutex, portMAX_DELAY);
+  #if dscWritePipeline
+  static bool setPartition;
+
+  // Sets the write partition if set by virtual keypad key '/'
+  if (setPartition) {
+    setPartition = false;
+    if (receivedKey >= '1' && receivedKey <= '8') dscWritePartition = receivedKey - 48;
+  }
+  else if (receivedKey == '/') setPartition = true;
+  else {
+    char keys[2] = { receivedKey, '\0' };
+    dscWriteSequence(keys);
+  }
+  #else
+  while(dscPanelKeyPending) vTaskDelay(1);
   dscSetWriteKey(receivedKey);
+  #endif
+  xSemaphoreGive(dscWriteMutex);
 }
 
 
 // Sets up writes for multiple keys sent as a char array
 void dscWriteKeys(const char *receivedKeys) {
-  while(dscPanelKeyPending || dscPanelKeysPending) vTaskDelay(1);
-  dscPanelKeysArray = receivedKeys;
-  if (dscPanelKeysArray[0] != '\0') dscPanelKeysPending = true;
-  while (dscPanelKeysPending) {
-    static byte writeCounter = 0;
-    if (!dscPanelKeyPending && writeCounter < strlen(dscPanelKeysArray)) {
-      if (dscPanelKeysArray[writeCounter] != '\0') {
-        dscSetWriteKey(dscPanelKeysArray[writeCounter]);
-        writeCounter++;
-        if (dscPanelKeysArray[writeCounter] == '\0') {
-          dscPanelKeysPending = false;
-          writeCounter = 0;
+  xSemaphoreTake(dscWriteMutex, portMAX_DELAY);
+  while(dscPanelKeyPending) vTaskDelay(1);
+  dscWriteSequence(receivedKeys);
+  xSemaphoreGive(dscWriteMutex);
+}
+
+
+// Queues the keys to write to the partition, returns without waiting for the keys to be written.  Safe to call from
+// multiple tasks - sequences are written in the order they were queued.
+bool dscWriteAsync(const char *keys, byte partition, dscWriteCallback callback, void *context) {
+  #if dscWritePipeline
+  if (dscWriteLoopHandle == NULL || strlen(keys) >= dscWriteKeysSize) return false;
+  if (partition == 0) partition = dscWritePartition;
+  #else
+  if (dscWriteQueue == NULL || strlen(keys) >= dscWriteKeysSize) return false;
+  #endif
+
+  dscWriteRequest request;
+  strcpy(request.keys, keys);
+  request.partition = partition;
+  request.callback = callback;
+  request.context = context;
+
+  // Sequences for each partition are queued separately, an invalid partition is reported by dscWriteLoop() from the
+  // queue for partition 1
+  #if dscWritePipeline
+  byte queueIndex = (partition > 0 && partition <= dscPartitions) ? partition - 1 : 0;
+  if (xQueueSend(dscWriteQueues[queueIndex], &request, 0) != pdTRUE) return false;
+  xTaskNotifyGive(dscWriteLoopHandle);
+  return true;
+  #else
+  return xQueueSend(dscWriteQueue, &request, 0) == pdTRUE;
+  #endif
+}
+
+
+#if dscWritePipeline
+// Starts the task writing key sequences queued by dscWriteAsync(), with a queue for each partition
+void dscWriteQueueBegin(UBaseType_t priority) {
+  if (dscWriteLoopHandle != NULL) return;
+  for (byte i = 0; i < dscPartitions; i++) dscWriteQueues[i] = xQueueCreate(dscWriteQueueSize, sizeof(dscWriteRequest));
+  xTaskCreate(dscWriteLoop, "dscWriteLoop", 256, NULL, priority, &dscWriteLoopHandle);
+}
+
+
+// Writes the key sequences queued by dscWriteAsync(), run as a task by dscWriteQueueBegin().  A sequence is written
+// from the queue of each partition at the same time - dscClockInterrupt() writes the keys of each partition at its own
+// position in the status commands.
+void dscWriteLoop(void *parameters) {
+  (void) parameters;
+  static dscWriteRequest requests[dscPartitions];
+  static dscWriteProgress progress[dscPartitions];
+  static bool writing[dscPartitions];
+
+  while (1) {
+    bool busy = false;
+    for (byte i = 0; i < dscPartitions; i++) {
+      byte result = DSC_WRITE_PENDING;
+      if (!writing[i]) {
+        if (xQueueReceive(dscWriteQueues[i], &requests[i], 0) != pdTRUE) continue;
+        if (!dscVirtualKeypad || !dscKeybusConnected) result = DSC_WRITE_UNAVAILABLE;
+        else if (requests[i].partition == 0 || requests[i].partition > dscPartitions) result = DSC_WRITE_INVALID;
+        else {
+          dscWriteBegin(&progress[i], requests[i].keys, requests[i].partition);
+          writing[i] = true;
         }
       }
+      if (writing[i]) result = dscWriteStep(&progress[i]);
+
+      busy = true;  // Checks the queue again after a sequence completes
+      if (result == DSC_WRITE_PENDING) continue;
+      writing[i] = false;
+      if (requests[i].callback != NULL) requests[i].callback(result, requests[i].context);
+    }
+
+    if (dscCommandStep()) busy = true;
+    if (busy) vTaskDelay(1);
+    else ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // Waits for dscWriteAsync()
+  }
+}
+
+
+// Writes each key and waits until the keys are written, called with dscWriteMutex held.  Returns DSC_WRITE_TIMEOUT if
+// the panel does not take a key within dscWriteTimeout ms - the remaining keys are skipped.
+byte dscWriteSequence(const char *keys) {
+  if (dscWritePartition == 0 || dscWritePartition > dscPartitions) dscWritePartition = 1;
+
+  dscWriteProgress progress;
+  dscWriteBegin(&progress, keys, dscWritePartition);
+  byte result;
+  while ((result = dscWriteStep(&progress)) == DSC_WRITE_PENDING) vTaskDelay(1);
+  dscWritePartition = progress.partition;  // Keeps the partition set by '/' for the following writes
+  return result;
+}
+
+
+void dscWriteBegin(dscWriteProgress *progress, const char *keys, byte partition) {
+  progress->keys = keys;
+  progress->index = 0;
+  progress->partition = (partition > 0 && partition <= dscPartitions) ? partition : 1;
+  progress->claimed = false;
+  progress->keyCount = 0;
+  progress->progressTime = xTaskGetTickCount();
+  dscWriteActive(true);
+}
+
+
+// Queues the keys of a sequence in the key FIFO of its partition as space is available, returns DSC_WRITE_PENDING
+// until the keys are written.  Returns DSC_WRITE_TIMEOUT and cancels the queued keys if dscClockInterrupt() does not
+// write a key within dscWriteTimeout ms, or DSC_WRITE_FAILED if dscVerifyKey() does not read back a key as written.
+byte dscWriteStep(dscWriteProgress *progress) {
+  dscKeyQueue *queue;
+  while (1) {
+
+    // Claims the partition so keys from other sequences are not interleaved - waiting for a claim does not time out,
+    // the sequence holding the partition times out on its own
+    if (!progress->claimed) {
+      if (!dscClaimKeys(progress->partition - 1)) {
+        progress->progressTime = xTaskGetTickCount();
+        return DSC_WRITE_PENDING;
+      }
+      progress->claimed = true;
+      queue = &dscKeyFifo[progress->partition - 1];
+      progress->previousTail = queue->tail;
+      progress->previousPending = queue->pending;
+    }
+    queue = &dscKeyFifo[progress->partition - 1];
+
+    char key = progress->keys[progress->index];
+    if (key == '\0') break;
+
+    // Sets the write partition for the following keys with virtual keypad key '/' once the keys queued for the
+    // current partition are written
+    if (key == '/') {
+      if (queue->head != queue->tail || queue->pending) break;
+      char partition = progress->keys[progress->index + 1];
+      progress->index++;
+      if (partition >= '1' && partition <= '8') {
+        progress->index++;
+        dscReleaseKeys(progress->partition - 1);
+        progress->claimed = false;
+        progress->partition = partition - 48;
+        if (dscPartitions < progress->partition) progress->partition = 1;
+        progress->progressTime = xTaskGetTickCount();
+      }
+      continue;
     }
-    else vTaskDelay(1);
+
+    byte flags;
+    int code = dscKeyCode(key, &flags);
+    if (code >= 0) {
+      byte fifoHead = queue->head;
+      if (((fifoHead - queue->tail) & (dscKeyFifoSize - 1)) == dscKeyFifoSize - 1) break;  // Waits for space
+      if (flags & dscKeyArm) dscWriteArm[progress->partition - 1] = true;
+      queue->fifo[fifoHead].key = code;
+      queue->fifo[fifoHead].flags = flags;
+      dscMemoryBarrier();
+      queue->head = (fifoHead + 1) & (dscKeyFifoSize - 1);
+      progress->keyCount++;
+    }
+    progress->index++;
+  }
+
+  // Fails the sequence if a key is not read back as written after dscWriteRetries retries
+  if (queue->failed) {
+    dscCancelKeys(progress->partition - 1);
+    dscReleaseKeys(progress->partition - 1);
+    dscWriteActive(false);
+    return DSC_WRITE_FAILED;
+  }
+
+  // Completes the sequence after the last key is written, including the panel response to '*'
+  if (progress->keys[progress->index] == '\0' && queue->head == queue->tail && !queue->pending) {
+    dscReleaseKeys(progress->partition - 1);
+    dscHealth.writeKeys += progress->keyCount;
+    dscWriteActive(false);
+    return DSC_WRITE_DONE;
+  }
+
+  if (queue->tail != progress->previousTail || queue->pending != progress->previousPending) {
+    progress->previousTail = queue->tail;
+    progress->previousPending = queue->pending;
+    progress->progressTime = xTaskGetTickCount();
   }
+  else if ((xTaskGetTickCount() - progress->progressTime) * portTICK_PERIOD_MS > dscWriteTimeout) {
+    dscCancelKeys(progress->partition - 1);
+    dscReleaseKeys(progress->partition - 1);
+    dscWriteActive(false);
+    return DSC_WRITE_TIMEOUT;
+  }
+  return DSC_WRITE_PENDING;
+}
+
+
+// Tracks the time with at least one sequence writing, so sequences written at the same time are not counted twice in
+// dscHealth.writeTime
+void dscWriteActive(bool active) {
+  static byte sequences;
+  static unsigned long startTime;
+  taskENTER_CRITICAL();
+  if (active && sequences++ == 0) startTime = millis();
+  else if (!active && --sequences == 0) dscHealth.writeTime += millis() - startTime;
+  taskEXIT_CRITICAL();
+}
+
+
+// Claims the key FIFO of the partition for a sequence, returns false if another sequence is writing to the partition
+bool dscClaimKeys(byte partitionIndex) {
+  bool claimed = false;
+  taskENTER_CRITICAL();
+  if (!dscKeyFifo[partitionIndex].claimed) {
+    dscKeyFifo[partitionIndex].claimed = true;
+    claimed = true;
+  }
+  taskEXIT_CRITICAL();
+  return claimed;
+}
+
+
+void dscReleaseKeys(byte partitionIndex) {
+  dscKeyFifo[partitionIndex].claimed = false;
+}
+
+
+// Cancels the keys queued for the partition and the key being written
+void dscCancelKeys(byte partitionIndex) {
+  dscKeyQueue *queue = &dscKeyFifo[partitionIndex];
+  taskENTER_CRITICAL();
+  queue->tail = queue->head;
+  if (dscWriteAlarmPartition == partitionIndex + 1) {
+    dscPanelKeyPending = false;
+    dscWriteAlarm = false;
+    dscWriteAlarmPartition = 0;
+  }
+  if (dscWriteEchoPartition == partitionIndex + 1) {
+    dscWriteEchoBit = 0;
+    dscWriteEchoPartition = 0;
+  }
+  queue->pending = false;
+  queue->asterisk = false;
+  queue->failed = false;
+  taskEXIT_CRITICAL();
+}
+
+
+// Loads the key at the tail of each partition key FIFO once the previous key of the partition is written, called by
+// dscClockInterrupt().  Alarm keys are written at the start of the next command one at a time, and the following keys
+// of the partition wait for the repeat of the alarm key.
+void IRAM dscLoadKeys(bool writeRepeat) {
+  for (byte i = 0; i < dscPartitions; i++) {
+    dscKeyQueue *queue = &dscKeyFifo[i];
+    if (!queue->pending && !queue->failed && queue->tail != queue->head) {
+      const dscKeyEntry *entry = &queue->fifo[queue->tail];
+      queue->key = entry->key;
+      queue->flags = entry->flags;
+      queue->tail = (queue->tail + 1) & (dscKeyFifoSize - 1);
+      queue->retries = 0;
+      queue->mismatch = false;
+      queue->loadTime = millis();
+      queue->pending = true;
+    }
+
+    if (queue->pending && (queue->flags & dscKeyAlarm) && dscWriteAlarmPartition == 0 && !writeRepeat) {
+      dscPanelKey = queue->key;
+      dscWriteAlarm = true;
+      dscWriteAlarmPartition = i + 1;
+      dscPanelKeyPending = true;
+    }
+  }
+}
+
+
+// Compares the key read back from the data line with the key written by dscClockInterrupt(), called by
+// dscDataInterrupt().  A key that does not match, for example if a keypad sent data at the same time, is written again
+// up to dscWriteRetries times before the sequence fails.  Alarm keys are compared after the repeat for 0x1C.
+void IRAM dscVerifyKey() {
+  if (dscWriteEchoPartition == 0) return;
+  dscKeyQueue *queue = &dscKeyFifo[dscWriteEchoPartition - 1];
+  if (dscWriteEcho != queue->key) queue->mismatch = true;
+  if (!dscWriteEchoLast) return;
+
+  if (!queue->mismatch) {
+    unsigned long latency = millis() - queue->loadTime;
+    dscHealth.writeVerified++;
+    dscHealth.writeLatency += latency;
+    if (latency > dscHealth.writeLatencyMax) dscHealth.writeLatencyMax = latency;
+    if (queue->flags & dscKeyAsterisk) queue->asterisk = true;  // Delays writing after pressing '*' until the panel is ready
+    else queue->pending = false;
+  }
+  else if (queue->retries < dscWriteRetries) {
+    queue->retries++;
+    queue->mismatch = false;
+    dscHealth.writeRetries++;
+  }
+  else {
+    queue->failed = true;
+    queue->pending = false;
+    dscHealth.writeFailures++;
+  }
+
+  if (queue->flags & dscKeyAlarm) dscWriteAlarmPartition = 0;  // dscLoadKeys() sets up a retried alarm key again
+}
+
+
+// Returns the partition index with its write position at this byte of the current status command and sets the first
+// bit of the position, or 0xFF if no partition is written at this byte
+byte IRAM dscWriteSlot(byte byteCount, byte *writeBit) {
+  byte partitionIndex;
+  switch (byteCount) {
+    case 2: partitionIndex = 0; *writeBit = 9; break;
+    case 3: partitionIndex = 1; *writeBit = 17; break;
+    case 8: partitionIndex = 2; *writeBit = 57; break;
+    case 9: partitionIndex = 3; *writeBit = 65; break;
+    default: return 0xFF;
+  }
+  if (dscStatusCmd == 0x05) return partitionIndex;
+  if (dscStatusCmd == 0x1B) return partitionIndex + 4;
+  return 0xFF;
+}
+
+#else
+// Starts the task writing key sequences queued by dscWriteAsync()
+void dscWriteQueueBegin(UBaseType_t priority) {
+  if (dscWriteQueue != NULL) return;
+  dscWriteQueue = xQueueCreate(dscWriteQueueSize, sizeof(dscWriteRequest));
+  xTaskCreate(dscWriteLoop, "dscWriteLoop", 256, NULL, priority, NULL);
+}
+
+
+// Writes the key sequences queued by dscWriteAsync(), run as a task by dscWriteQueueBegin()
+void dscWriteLoop(void *parameters) {
+  (void) parameters;
+  dscWriteRequest request;
+
+  while (1) {
+
+    // Checks commands waiting for the panel every tick while a command is in progress
+    if (xQueueReceive(dscWriteQueue, &request, dscCommandStep() ? 1 : portMAX_DELAY) != pdTRUE) continue;
+
+    byte result;
+    xSemaphoreTake(dscWriteMutex, portMAX_DELAY);
+    if (!dscVirtualKeypad || !dscKeybusConnected) result = DSC_WRITE_UNAVAILABLE;
+    else if (request.partition > dscPartitions) result = DSC_WRITE_INVALID;
+    else if (!dscWaitKeyWritten()) result = DSC_WRITE_TIMEOUT;
+    else {
+      if (request.partition > 0) dscWritePartition = request.partition;
+      result = dscWriteSequence(request.keys);
+    }
+    xSemaphoreGive(dscWriteMutex);
+
+    if (request.callback != NULL) request.callback(result, request.context);
+  }
+}
+
+
+// Writes each key and waits until it is written by dscClockInterrupt(), called with dscWriteMutex held.  Returns
+// DSC_WRITE_TIMEOUT if a key is not written within dscWriteTimeout ms - the remaining keys are skipped.
+byte dscWriteSequence(const char *keys) {
+  unsigned long startTime = millis();
+  byte keyCount = 0;
+  for (byte i = 0; keys[i] != '\0'; i++) {
+    while (!dscSetWriteKey(keys[i])) vTaskDelay(1);  // Waits for the delay after alarm keys
+    if (!dscWaitKeyWritten()) return DSC_WRITE_TIMEOUT;
+    byte flags;
+    if (dscKeyCode(keys[i], &flags) >= 0 && (i == 0 || keys[i - 1] != '/')) keyCount++;
+  }
+  dscHealth.writeKeys += keyCount;
+  dscHealth.writeTime += millis() - startTime;
+  return DSC_WRITE_DONE;
+}
+#endif
+
+
+// Waits until the pending key is written, returns false and cancels the key if it is not written within
+// dscWriteTimeout ms
+bool dscWaitKeyWritten() {
+  TickType_t startTime = xTaskGetTickCount();
+  while (dscPanelKeyPending) {
+    if ((xTaskGetTickCount() - startTime) * portTICK_PERIOD_MS > dscWriteTimeout) {
+      taskENTER_CRITICAL();
+      dscPanelKeyPending = false;
+      dscWriteAlarm = false;
+      dscWriteAsterisk = false;
+      dscWroteAsterisk = false;
+      taskEXIT_CRITICAL();
+      return false;
+    }
+    vTaskDelay(1);
+  }
+  return true;
 }
 
 
 // Specifies the key value to be written by dscClockInterrupt() and selects the write partition.  This includes a 500ms
-// delay after alarm keys to resolve errors when additional keys are sent immediately after alarm keys.
-void dscSetWriteKey(int receivedKey) {
+// delay after alarm keys to resolve errors when additional keys are sent immediately after alarm keys - returns false if
+// the key was not set due to the delay or a pending key.
+bool dscSetWriteKey(int receivedKey) {
   static unsigned long previousTime;
   static bool setPartition;
 
@@ -531,89 +1401,110 @@ void dscSetWriteKey(int receivedKey) {
     if (receivedKey >= '1' && receivedKey <= '8') {
       dscWritePartition = receivedKey - 48;
     }
-    return;
+    return true;
   }
 
   // Sets the binary to write for virtual keypad keys
   if (!dscPanelKeyPending && millis() - previousTime > 500) {
-    bool validKey = true;
-    switch (receivedKey) {
-      case '/': setPartition = true; validKey = false; break;
-      case '0': dscPanelKey = 0x00; break;
-      case '1': dscPanelKey = 0x05; break;
-      case '2': dscPanelKey = 0x0A; break;
-      case '3': dscPanelKey = 0x0F; break;
-      case '4': dscPanelKey = 0x11; break;
-      case '5': dscPanelKey = 0x16; break;
-      case '6': dscPanelKey = 0x1B; break;
-      case '7': dscPanelKey = 0x1C; break;
-      case '8': dscPanelKey = 0x22; break;
-      case '9': dscPanelKey = 0x27; break;
-      case '*': dscPanelKey = 0x28; dscWriteAsterisk = true; break;
-      case '#': dscPanelKey = 0x2D; break;
-      case 'F':
-      case 'f': dscPanelKey = 0x77; dscWriteAlarm = true; break;  // Keypad fire alarm
-      case 's':
-      case 'S': dscPanelKey = 0xAF; dscWriteArm[dscWritePartition - 1] = true; break;  // Arm stay
-      case 'w':
-      case 'W': dscPanelKey = 0xB1; dscWriteArm[dscWritePartition - 1] = true; break;  // Arm away
-      case 'n':
-      case 'N': dscPanelKey = 0xB6; dscWriteArm[dscWritePartition - 1] = true; break;  // Arm with no entry delay (night arm)
-      case 'A':
-      case 'a': dscPanelKey = 0xBB; dscWriteAlarm = true; break;  // Keypad auxiliary alarm
-      case 'c':
-      case 'C': dscPanelKey = 0xBB; break;                        // Door chime
-      case 'r':
-      case 'R': dscPanelKey = 0xDA; break;                        // Reset
-      case 'P':
-      case 'p': dscPanelKey = 0xDD; dscWriteAlarm = true; break;  // Keypad panic alarm
-      case 'x':
-      case 'X': dscPanelKey = 0xE1; break;                        // Exit
-      case '[': dscPanelKey = 0xD5; break;                        // Command output 1
-      case ']': dscPanelKey = 0xDA; break;                        // Command output 2
-      case '{': dscPanelKey = 0x70; break;                        // Command output 3
-      case '}': dscPanelKey = 0xEC; break;                        // Command output 4
-      default: {
-        validKey = false;
-        break;
-      }
-    }
+    byte flags = 0;
+    int key = -1;
+    if (receivedKey == '/') setPartition = true;
+    else key = dscKeyCode(receivedKey, &flags);
 
     // Sets the writing position in dscClockInterrupt() for the currently set partition
     if (dscPartitions < dscWritePartition) dscWritePartition = 1;
-    switch (dscWritePartition) {
-      case 1:
-      case 5: {
-        dscWriteByte = 2;
-        dscWriteBit = 9;
-        break;
-      }
-      case 2:
-      case 6: {
-        dscWriteByte = 3;
-        dscWriteBit = 17;
-        break;
-      }
-      case 3:
-      case 7: {
-        dscWriteByte = 8;
-        dscWriteBit = 57;
-        break;
-      }
-      case 4:
-      case 8: {
-        dscWriteByte = 9;
-        dscWriteBit = 65;
-        break;
-      }
-      default: {
-        dscWriteByte = 2;
-        dscWriteBit = 9;
-        break;
-      }
+    dscSetWritePosition(dscWritePartition);
+
+    if (key >= 0) {
+      dscPanelKey = key;
+      if (flags & dscKeyAlarm) dscWriteAlarm = true;
+      if (flags & dscKeyAsterisk) dscWriteAsterisk = true;
+      if (flags & dscKeyArm) dscWriteArm[dscWritePartition - 1] = true;
     }
 
     if (dscWriteAlarm) previousTime = millis();  // Sets a marker to time writes after keypad alarm keys
-    if (validKey) dscPanelKeyPending = true;     // Sets a flag indicating that a write is pending, cleared by dscClockInterrupt()
+    if (key >= 0) dscPanelKeyPending = true;     // Sets a flag indicating that a write is pending, cleared by dscClockInterrupt()
+    return true;
+  }
+  return false;
+}
+
+
+// Returns the Keybus code for a virtual keypad key and sets the dscKey* flags for the key, or -1 if the key is not valid
+int dscKeyCode(int receivedKey, byte *flags) {
+  *flags = 0;
+  switch (receivedKey) {
+    case '0': return 0x00;
+    case '1': return 0x05;
+    case '2': return 0x0A;
+    case '3': return 0x0F;
+    case '4': return 0x11;
+    case '5': return 0x16;
+    case '6': return 0x1B;
+    case '7': return 0x1C;
+    case '8': return 0x22;
+    case '9': return 0x27;
+    case '*': *flags = dscKeyAsterisk; return 0x28;
+    case '#': return 0x2D;
+    case 'F':
+    case 'f': *flags = dscKeyAlarm; return 0x77;  // Keypad fire alarm
+    case 's':
+    case 'S': *flags = dscKeyArm; return 0xAF;    // Arm stay
+    case 'w':
+    case 'W': *flags = dscKeyArm; return 0xB1;    // Arm away
+    case 'n':
+    case 'N': *flags = dscKeyArm; return 0xB6;    // Arm with no entry delay (night arm)
+    case 'A':
+    case 'a': *flags = dscKeyAlarm; return 0xBB;  // Keypad auxiliary alarm
+    case 'c':
+    case 'C': return 0xBB;                        // Door chime
+    case 'r':
+    case 'R': return 0xDA;                        // Reset
+    case 'P':
+    case 'p': *flags = dscKeyAlarm; return 0xDD;  // Keypad panic alarm
+    case 'x':
+    case 'X': return 0xE1;                        // Exit
+    case '[': return 0xD5;                        // Command output 1
+    case ']': return 0xDA;                        // Command output 2
+    case '{': return 0x70;                        // Command output 3
+    case '}': return 0xEC;                        // Command output 4
+    default: return -1;
+  }
+}
+
+
+// Sets the status command and position where dscClockInterrupt() writes keys for the partition
+void IRAM dscSetWritePosition(byte partition) {
+  switch (partition) {
+    case 1:
+    case 5: {
+      dscWriteByte = 2;
+      dscWriteBit = 9;
+      break;
+    }
+    case 2:
+    case 6: {
+      dscWriteByte = 3;
+      dscWriteBit = 17;
+      break;
+    }
+    case 3:
+    case 7: {
+      dscWriteByte = 8;
+      dscWriteBit = 57;
+      break;
+    }
+    case 4:
+    case 8: {
+      dscWriteByte = 9;
+      dscWriteBit = 65;
+      break;
+    }
+    default: {
+      dscWriteByte = 2;
+      dscWriteBit = 9;
+      break;
+    }
   }
+  dscWriteStatusCmd = (partition > 4) ? 0x1B : 0x05;
 }
@@ -24,23 +24,76 @@
 #include <espressif/esp_common.h>
 #include <esp/uart.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <task.h>
 #include <semphr.h>
+#include <queue.h>
 #include <string.h>
+#include <time.h>
 #include "dscSettings.h"
 
 
 // Data setup - partitions, zones, and buffer size can be overridden by setting in dscSettings.h
+// Commands for partitions and zones beyond dscPartitions and dscZones are not processed or decoded - the defaults
+// decode all commands
 #ifndef dscPartitions
-#define dscPartitions 8   // Maximum number of partitions - requires 19 bytes of memory per partition
+#define dscPartitions 8   // Maximum number of partitions - requires 14 bytes of memory per partition
 #endif
 #ifndef dscZones
 #define dscZones 8        // Maximum number of zone groups, 8 zones per group - requires 6 bytes of memory per zone group
 #endif
 #ifndef dscBufferSize
-#define dscBufferSize 50  // Number of commands to buffer if the sketch is busy - requires dscReadSize + 2 bytes of memory per command
+#define dscBufferSize 50  // Number of commands to buffer if the sketch is busy (253 max) - requires dscReadSize + 8 bytes of memory per command
 #endif
 #define dscReadSize 16    // Maximum bytes of a Keybus command
+#ifndef dscBufferAllocate
+#define dscBufferAllocate 0  // Set to 1 to allocate the panel buffer at dscBegin() with dscPanelBufferFrames commands, and to grow it once by dscPanelBufferReserve commands after the first overflow
+#endif
+#ifndef dscModuleBufferSize
+#define dscModuleBufferSize 16  // Number of keypad and module responses to buffer if the sketch is busy (253 max) - requires dscReadSize + 8 bytes of memory per response
+#endif
+#ifndef dscEventLogSize
+#define dscEventLogSize 32  // Number of status events kept for subscribers, must be a power of 2 - requires 8 bytes of memory per event
+#endif
+#ifndef dscSubscribers
+#define dscSubscribers 4  // Maximum number of tasks subscribed to status events - requires 16 bytes of memory per subscriber
+#endif
+#ifndef dscTraceQueueSize
+#define dscTraceQueueSize 32  // Number of commands to queue for trace capture after dscTraceBegin() - requires dscReadSize + 8 bytes of memory per command
+#endif
+#ifndef dscWriteQueueSize
+#define dscWriteQueueSize 4  // Key sequences queued by dscWriteAsync() after dscWriteQueueBegin(), for each partition with dscWritePipeline - requires dscWriteKeysSize + 12 bytes of memory per sequence
+#endif
+#ifndef dscWriteKeysSize
+#define dscWriteKeysSize 32  // Maximum length of a key sequence queued by dscWriteAsync(), including the terminating '\0'
+#endif
+#ifndef dscWriteTimeout
+#define dscWriteTimeout 5000  // Milliseconds to wait for the panel to accept each key before a key sequence fails
+#endif
+#ifndef dscWritePipeline
+#define dscWritePipeline 0  // Set to 1 to queue keys for dscClockInterrupt() to write each key at the first status command after the previous key, with a write queue for each partition and each key read back from the Keybus - requires 32 bytes of memory per partition, and dscWriteQueueSize sequences per partition
+#endif
+#ifndef dscCommandTimeout
+#define dscCommandTimeout 10000  // Milliseconds to wait for the panel to show the target state of dscArm() and dscDisarm() after the keys are written
+#endif
+#ifndef dscWriteRetries
+#define dscWriteRetries 3  // Writes of a key again with dscWritePipeline if the key is not read back from the Keybus as written
+#endif
+#ifndef dscPrintRingSize
+#define dscPrintRingSize 512  // Bytes of output buffered by dscPrintDrainBegin(), must be a power of 2 - requires 1 byte of memory per byte
+#endif
+#ifndef dscRedundantDataHash
+#define dscRedundantDataHash 0  // Set to 1 to detect redundant data with a 32-bit hash of each command instead of comparing bytes - requires 4 bytes of memory per buffered command
+#endif
+#ifndef dscLatencyStats
+#define dscLatencyStats 0  // Set to 1 to measure the latency of each command from the Keybus to the sketch, see dscLatencyPrint() - requires 1KB of memory plus 8 bytes per buffered command
+#endif
+#ifndef dscLatencyCommands
+#define dscLatencyCommands 4  // Number of command bytes with separate latency statistics, the first received - requires 1KB of memory per command
+#endif
+#ifndef dscIsrProfile
+#define dscIsrProfile 0  // Set to 1 to measure the execution time of dscClockInterrupt() and dscDataInterrupt(), see dscIsrProfilePrint() - requires 168 bytes of memory
+#endif
 
 // Arduino syntax compatibility wrappers
 #define HIGH 1
@@ -50,10 +103,14 @@ int digitalRead(uint8_t pin) __attribute__ ((weak, alias("gpio_read")));
 void digitalWrite(uint8_t pin, uint8_t val) __attribute__ ((weak, alias("gpio_write")));
 #define millis()  (xTaskGetTickCount() * portTICK_PERIOD_MS)
 #define micros() sdk_system_get_time()
+#ifndef dscCycleCount
+#define dscCycleCount() __extension__ ({ uint32_t ccount; __asm__ __volatile__ ("rsr %0, ccount" : "=a" (ccount)); ccount; })  // CPU cycle counter
+#endif
 #define bitRead(value, bit) (((value) >> (bit)) & 0x01)
 #define bitSet(value, bit) ((value) |= (1UL << (bit)))
 #define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
-#define bitWrite(value, bit, bitvalue) (bitvalue ? bitSet(value, bit) : bitClear(value, bit))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define dscMemoryBarrier() __asm__ __volatile__ ("" ::: "memory")  // Single core: prevents compiler reordering around buffer index updates
 
 // esp8266 NodeMCU/Wemos development board pins to GPIO mapping
 #define D0 16
@@ -66,64 +123,260 @@ void digitalWrite(uint8_t pin, uint8_t val) __attribute__ ((weak, alias("gpio_wr
 #define D7 13
 #define D8 15
 
+// Keybus command as captured by dscDataInterrupt()
+typedef struct {
+  byte data[dscReadSize];  // Command [0], stop bit by itself [1], followed by the remaining data
+  byte bitCount;           // Total bits received, including the stop bit
+  byte byteCount;          // Bytes received, including the stop bit byte
+  uint32_t time;           // micros() when the command completed
+  #if dscRedundantDataHash
+  uint32_t hash;           // FNV-1a hash of the received bytes, calculated by dscDataInterrupt() as each byte completes
+  #endif
+  #if dscLatencyStats
+  uint32_t edgeCycles;     // dscCycleCount() at the final clock edge of the command
+  uint32_t cycles;         // dscCycleCount() when the command was stored in the panel buffer
+  #endif
+} dscFrame;
+
+// Keypad and module response as captured by dscDataInterrupt()
+typedef struct {
+  byte data[dscReadSize];  // Same layout as dscFrame
+  byte bitCount;
+  byte byteCount;
+  byte panelCommand;       // Panel command the keypad or module responded to
+  uint32_t time;           // micros() when the response completed
+} dscModuleFrame;
+
+// Keybus trace record - see dscKeybusTrace-RTOS.c for the binary trace format
+typedef struct {
+  uint32_t time;           // micros() when the command completed
+  byte flags;              // DSC_TRACE_* flags
+  byte bitCount;
+  byte byteCount;
+  byte panelCommand;       // Module records: panel command the keypad or module responded to
+  byte data[dscReadSize];
+} dscTraceRecord;
+
+#define DSC_TRACE_MODULE 0x01    // Keypad or module response
+#define DSC_TRACE_OVERFLOW 0x02  // Commands were dropped before this record
+#define dscTraceHeader "DSCT\x01"
+#define dscTraceHeaderSize 5
+#define dscTraceRecordSize (dscReadSize + 9)  // Maximum encoded record size
+
 // Exit delay target states
 #define DSC_EXIT_STAY 1
 #define DSC_EXIT_AWAY 2
 #define DSC_EXIT_NO_ENTRY_DELAY 3
 
+// Partition status flags - bit positions in dscPartitionStatus[] and dscPartitionChanged[]
+#define DSC_STATUS_READY 0
+#define DSC_STATUS_ARMED 1
+#define DSC_STATUS_ARMED_AWAY 2
+#define DSC_STATUS_ARMED_STAY 3
+#define DSC_STATUS_NO_ENTRY_DELAY 4
+#define DSC_STATUS_ALARM 5
+#define DSC_STATUS_EXIT_DELAY 6
+#define DSC_STATUS_ENTRY_DELAY 7
+#define DSC_STATUS_FIRE 8
+#define DSC_STATUS_EXIT_STATE 9   // Changed flag only, the state is in dscExitState[]
+#define DSC_STATUS_ACCESS_CODE 10 // Changed flag only, the code is in dscAccessCode[]
+#define dscReady(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_READY)
+#define dscArmed(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_ARMED)
+#define dscArmedAway(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_ARMED_AWAY)
+#define dscArmedStay(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_ARMED_STAY)
+#define dscNoEntryDelay(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_NO_ENTRY_DELAY)
+#define dscAlarm(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_ALARM)
+#define dscExitDelay(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_EXIT_DELAY)
+#define dscEntryDelay(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_ENTRY_DELAY)
+#define dscFire(partition) bitRead(dscPartitionStatus[partition], DSC_STATUS_FIRE)
+
+// System status flags - bit positions in dscStatusSnapshot.system
+#define DSC_STATUS_KEYBUS 0
+#define DSC_STATUS_TROUBLE 1
+#define DSC_STATUS_POWER_TROUBLE 2
+#define DSC_STATUS_BATTERY_TROUBLE 3
+#define DSC_STATUS_KEYPAD_FIRE 4
+#define DSC_STATUS_KEYPAD_AUX 5
+#define DSC_STATUS_KEYPAD_PANIC 6
+
+// Consistent copy of the tracked status, see dscSnapshot() and dscDiff()
+typedef struct {
+  uint16_t partition[dscPartitions];  // dscPartitionStatus[]
+  byte exitState[dscPartitions];
+  byte accessCode[dscPartitions];
+  byte openZones[dscZones];
+  byte alarmZones[dscZones];
+  byte system;                        // DSC_STATUS_KEYBUS ... DSC_STATUS_KEYPAD_PANIC flags
+} dscStatusSnapshot;
+
+// Keybus health counters since dscBegin() or dscHealthReset(), see dscHealthSnapshot()
+typedef struct {
+  uint32_t panelFrames;        // Panel commands captured by dscDataInterrupt()
+  uint32_t filteredFrames;     // Panel commands dropped by dscDataInterrupt(): incomplete, or redundant 0x05/0x1B status
+  uint32_t overflowFrames;     // Panel commands dropped with the panel buffer full
+  uint32_t redundantFrames;    // Panel commands skipped as redundant by dscPanelLoop()
+  uint32_t crcErrors;          // Panel commands not processed due to an invalid CRC
+  uint32_t moduleFrames;       // Keypad/module responses captured by dscDataInterrupt()
+  uint32_t moduleOverflows;    // Keypad/module responses dropped with the module buffer full
+  uint32_t keybusDisconnects;  // Keybus data not detected for 3s
+  uint32_t writeKeys;          // Keys written by dscWriteKeys() and dscWriteAsync()
+  uint32_t writeTime;          // Milliseconds writing these keys, counted once for sequences written at the same time - writeKeys * 1000 / writeTime is the keys per second
+  uint32_t writeVerified;      // Keys read back from the Keybus as written, with dscWritePipeline
+  uint32_t writeRetries;       // Keys written again after a write was not read back as written
+  uint32_t writeFailures;      // Keys not read back as written after dscWriteRetries retries
+  uint32_t writeLatency;       // Milliseconds from loading each verified key until it was read back - writeLatency / writeVerified is the mean
+  uint32_t writeLatencyMax;
+  byte bufferHighWater;        // Most commands waiting in the panel buffer
+} dscHealthCounters;
+
+// Status events - each task subscribes to the events it needs and reads them at its own pace, for example:
+//   int subscriber = dscSubscribe(dscEventBit(DSC_EVENT_ARMED) | dscEventBit(DSC_EVENT_ZONE_OPEN));
+//   while (dscReadEvent(subscriber, &event, portMAX_DELAY)) { ... }
+#define DSC_EVENT_KEYBUS 0           // State: Keybus connected
+#define DSC_EVENT_READY 1            // Index: partition, state: ready
+#define DSC_EVENT_ARMED 2            // Index: partition, state: DSC_EXIT_STAY, DSC_EXIT_AWAY, or 0 if disarmed
+#define DSC_EVENT_ALARM 3            // Index: partition, state: in alarm
+#define DSC_EVENT_EXIT_DELAY 4       // Index: partition, state: exit delay in progress
+#define DSC_EVENT_EXIT_STATE 5       // Index: partition, state: DSC_EXIT_STAY, DSC_EXIT_AWAY, DSC_EXIT_NO_ENTRY_DELAY
+#define DSC_EVENT_ENTRY_DELAY 6      // Index: partition, state: entry delay in progress
+#define DSC_EVENT_FIRE 7             // Index: partition, state: fire alarm
+#define DSC_EVENT_ACCESS_CODE 8      // Index: partition, state: access code number
+#define DSC_EVENT_ZONE_OPEN 9        // Index: zone (0 = zone 1), state: open
+#define DSC_EVENT_ZONE_ALARM 10      // Index: zone (0 = zone 1), state: in alarm
+#define DSC_EVENT_TIMESTAMP 11       // Panel time in dscYear, dscMonth, dscDay, dscHour, dscMinute
+#define DSC_EVENT_TROUBLE 12         // State: trouble
+#define DSC_EVENT_POWER_TROUBLE 13   // State: AC power trouble
+#define DSC_EVENT_BATTERY_TROUBLE 14 // State: battery trouble
+#define DSC_EVENT_KEYPAD_FIRE 15     // Keypad fire alarm
+#define DSC_EVENT_KEYPAD_AUX 16      // Keypad auxiliary alarm
+#define DSC_EVENT_KEYPAD_PANIC 17    // Keypad panic alarm
+#define DSC_EVENT_ALL 0xFFFFFFFF
+#define dscEventBit(type) (1UL << (type))
+
+typedef struct {
+  byte type;      // DSC_EVENT_*
+  byte index;     // Partition (0 = partition 1) or zone (0 = zone 1)
+  byte state;
+  uint32_t time;  // millis() when the status changed
+} dscEvent;
+
+typedef struct {
+  TaskHandle_t task;  // Notified when a selected event is added to the event log
+  uint32_t mask;      // Events to read as dscEventBit(DSC_EVENT_*) flags
+  uint32_t cursor;    // Sequence number of the next event to read
+  bool overflow;      // True if events were overwritten before this subscriber read them, cleared by the sketch
+} dscSubscriber;
+
 // Task handling
 TaskHandle_t dscPanelLoopHandle;
 SemaphoreHandle_t dscDataAvailable;
 bool dscPanelDataAvailable;
 
 // dscKeybusInterface library public
-void dscBegin();
+bool dscBegin();                               // Returns false if the panel buffer cannot be allocated with dscBufferAllocate set
 void dscStop();                                // Disables the clock hardware interrupt and data timer interrupt
 void dscResetStatus();                         // Resets the state of all status components as changed for sketches to get the current status
 
 // Write
 void dscWriteKey(int receivedKey);             // Writes a single key
-void dscWriteKeys(const char * receivedKeys);  // Writes multiple keys from a char array
+void dscWriteKeys(const char * receivedKeys);  // Writes multiple keys from a char array, returns after the last key is written
 byte dscWritePartition;                        // Set to a partition number for virtual keypad
 
+// Queued writes - dscWriteAsync() copies the keys to dscWriteQueue and returns immediately, a task writes each
+// sequence in order and calls its callback with the result.  With dscWritePipeline, each partition has its own queue
+// and sequences for different partitions are written at the same time, for example:
+//   void armed(byte result, void *context) { if (result != DSC_WRITE_DONE) ... }
+//   dscWriteQueueBegin(2);
+//   dscWriteAsync("1234", 1, armed, NULL);
+//   dscWriteAsync("1234", 3, armed, NULL);
+enum dscWriteResult {
+  DSC_WRITE_DONE,         // All keys were written
+  DSC_WRITE_TIMEOUT,      // A key was not written within dscWriteTimeout ms, the remaining keys were skipped - or the panel did not show the target state of a command within dscCommandTimeout ms
+  DSC_WRITE_UNAVAILABLE,  // The virtual keypad is disabled or the Keybus is disconnected
+  DSC_WRITE_INVALID,      // The partition is not within dscPartitions
+  DSC_WRITE_FAILED,       // A key was not read back from the Keybus as written after dscWriteRetries retries, the remaining keys were skipped
+  DSC_WRITE_REJECTED      // The panel rejected the access code of a command (0x8F)
+};
+
+typedef void (*dscWriteCallback)(byte result, void *context);  // Called from the dscWriteLoop task
+
+void dscWriteQueueBegin(UBaseType_t priority);  // Starts the task writing queued key sequences at this priority
+bool dscWriteAsync(const char *keys, byte partition, dscWriteCallback callback, void *context);  // Partition 1-8, or 0 for dscWritePartition - returns false if the queue is full or the keys do not fit
+QueueHandle_t dscWriteQueue;
+
+// Commands - each command builds its keys in a fixed buffer and queues them with dscWriteAsync() after
+// dscWriteQueueBegin(), then tracks the partition until the panel shows the target state.  The callback gets the
+// result, and a partition runs one command at a time, for example:
+//   dscArm(1, DSC_ARM_AWAY, "1234", armed, NULL);  // The access code is written if the panel prompts for it
+//   dscDisarm(1, "1234", disarmed, NULL);
+enum dscArmMode {
+  DSC_ARM_STAY,           // Keypad stay arm
+  DSC_ARM_AWAY,           // Keypad away arm
+  DSC_ARM_NO_ENTRY_DELAY  // Keypad arm with no entry delay (night arm)
+};
+
+bool dscArm(byte partition, byte mode, const char *accessCode, dscWriteCallback callback, void *context);  // Completes at the exit delay or when armed - accessCode may be NULL, returns false if it has keys other than 0-9 or more than 8 digits
+bool dscDisarm(byte partition, const char *accessCode, dscWriteCallback callback, void *context);         // Completes when disarmed
+bool dscBypassZones(byte partition, const byte zones[dscZones], const char *accessCode, dscWriteCallback callback, void *context);  // Zones as in dscOpenZones, completes when written - zones that do not fit in one sequence are written in further sequences, accessCode may be NULL
+bool dscSetDateTime(const struct tm *time, const char *accessCode, dscWriteCallback callback, void *context);  // Partition 1, completes when written - returns false if partition 1 is not ready or the date/time is invalid
+
 // Prints output
 void dscPrintPanelBinary(bool printSpaces);    // Includes spaces between bytes by default
 void dscPrintPanelCommand();                   // Prints the panel command as hex
 void dscPrintPanelMessage();                   // Prints the decoded panel message
 void dscPrintModuleBinary(bool printSpaces);   // Includes spaces between bytes by default
 void dscPrintModuleMessage();                  // Prints the decoded keypad or module message
+void dscPrintf(const char *format, ...);       // Prints to dscPrintOutput, or to stdout if not set
+void dscPrintText(const char *text);           // Prints a fixed string without format parsing
+void (*dscPrintOutput)(const char *text, int length);  // Output sink for the print functions, for example to decode to a buffer or socket
+
+// Output sinks for dscPrintOutput
+void dscPrintDrainBegin(UBaseType_t priority);         // Buffers output in a ring written to stdout by a task at this priority
+void dscPrintBufferBegin(char *buffer, int size);      // Buffers output in memory supplied by the sketch
+int dscPrintBufferLength;                              // Length of the output in the sketch buffer
+void dscPrintToRing(const char *text, int length);     // Set by dscPrintDrainBegin()
+void dscPrintToBuffer(const char *text, int length);   // Set by dscPrintBufferBegin()
+void dscPrintToSocket(const char *text, int length);   // Writes to dscPrintSocket
+int dscPrintSocket;                                    // Socket for dscPrintToSocket(), set to -1 if the connection fails
+void dscPrintToNull(const char *text, int length);     // Counts output in dscPrintCount without writing it
+uint32_t dscPrintCount;                                // Bytes counted by dscPrintToNull()
+uint32_t dscPrintDropped;                              // Bytes dropped by a full ring or sketch buffer
 
 // Settings
 bool dscProcessRedundantData;      // Controls if repeated periodic commands are processed and displayed (default: false)
 bool dscProcessModuleData;         // Controls if keypad and module data is processed and displayed (default: false)
+#if dscRedundantDataHash
+bool dscSkipRedundantCommands;     // Skips any command identical to the last command of the same type, not only status and periodic commands - beeps are always processed (default: false)
+#endif
 
 // Panel time
 bool dscTimestampChanged;          // True after the panel sends a timestamped message
 byte dscHour, dscMinute, dscDay, dscMonth;
 int dscYear;
 
-// Sets panel time, the dscYear can be sent as either 2 or 4 digits
-void dscSetTime(unsigned int dscYear, byte dscMonth, byte dscDay, byte dscHour, byte dscMinute, const char* dscAccessCode);
+// Sets panel time through the write queue, the dscYear can be sent as either 2 or 4 digits - returns false if the keys
+// are not queued, for example before dscWriteQueueBegin() or while partition 1 has a command in progress
+bool dscSetTime(unsigned int dscYear, byte dscMonth, byte dscDay, byte dscHour, byte dscMinute, const char* dscAccessCode);
 
-// Status tracking
+// Status tracking - partition status is stored in dscPartitionStatus[] and dscPartitionChanged[] using 1 bit per
+// DSC_STATUS_* flag, for example:
+//   if (bitRead(dscPartitionChanged[partition], DSC_STATUS_READY)) {
+//     bitClear(dscPartitionChanged[partition], DSC_STATUS_READY);
+//     if (dscReady(partition)) ...
+//   }
+// Use dscSnapshot() to read a consistent copy of the status from another task.
 bool dscStatusChanged;                      // True after any status change
 bool dscPauseStatus;                        // Prevent status from showing as changed, set in sketch to control when to update status
 bool dscKeybusConnected, dscKeybusChanged;  // True if data is detected on the Keybus
 byte dscAccessCode[dscPartitions];
-bool dscAccessCodeChanged[dscPartitions];
 bool dscAccessCodePrompt;                   // True if the panel is requesting an access code
 bool dscTrouble, dscTroubleChanged;
 bool dscPowerTrouble, dscPowerChanged;
 bool dscBatteryTrouble, dscBatteryChanged;
 bool dscKeypadFireAlarm, dscKeypadAuxAlarm, dscKeypadPanicAlarm;
-bool dscReady[dscPartitions], dscReadyChanged[dscPartitions];
-bool dscArmed[dscPartitions], dscArmedAway[dscPartitions], dscArmedStay[dscPartitions];
-bool dscNoEntryDelay[dscPartitions], dscArmedChanged[dscPartitions];
-bool dscAlarm[dscPartitions], dscAlarmChanged[dscPartitions];
-bool dscExitDelay[dscPartitions], dscExitDelayChanged[dscPartitions];
-byte dscExitState[dscPartitions], dscExitStateChanged[dscPartitions];
-bool dscEntryDelay[dscPartitions], dscEntryDelayChanged[dscPartitions];
-bool dscFire[dscPartitions], dscFireChanged[dscPartitions];
+uint16_t dscPartitionStatus[dscPartitions];   // Partition status flags, 1 bit per DSC_STATUS_* flag
+uint16_t dscPartitionChanged[dscPartitions];  // Partition status changed flags, 1 bit per DSC_STATUS_* flag, reset by the sketch
+byte dscExitState[dscPartitions];             // DSC_EXIT_STAY, DSC_EXIT_AWAY, DSC_EXIT_NO_ENTRY_DELAY
 bool dscOpenZonesStatusChanged;
 byte dscOpenZones[dscZones], dscOpenZonesChanged[dscZones];    // Zone status is stored in an array using 1 bit per zone, up to 64 zones
 bool dscAlarmZonesStatusChanged;
@@ -137,8 +390,21 @@ byte dscAlarmZones[dscZones], dscAlarmZonesChanged[dscZones];  // Zone alarm sta
 //   Byte 0     Byte 2   Byte 3   Byte 4   Byte 5
 //   00000101 0 10000001 00000001 10010001 11000111 [0x05] Status lights: Ready Backlight | Partition ready
 //            ^ Byte 1 (stop bit)
-byte dscPanelData[dscReadSize];
-volatile byte dscModuleData[dscReadSize];
+//
+// dscPanelData points to the command in the panel buffer, dscPanelFrame to the same command with its bit and byte
+// counts.  Without dscRetainPanelData, the command is only valid until dscPanelLoop() moves to the next command and
+// can be overwritten by dscDataInterrupt() while the sketch is still reading it if the sketch falls behind - sketches
+// that read dscPanelData or dscPanelFrame set dscRetainPanelData and call dscReleasePanelData() when finished with
+// each command, as in the KeybusReader example.
+const byte *dscPanelData;
+const dscFrame *dscPanelFrame;
+bool dscRetainPanelData;           // Controls if dscPanelLoop() waits for dscReleasePanelData() after each command (default: false)
+void dscReleasePanelData();        // Releases dscPanelData back to the panel buffer when dscRetainPanelData is set
+
+// dscModuleData points to the keypad or module response in the module buffer set by dscHandleModule(), and
+// dscModuleCmd to the panel command it responded to.  The response stays valid until the next dscHandleModule().
+const byte *dscModuleData;
+byte dscModuleCmd;
 
 // dscStatus[] and dscLights[] store the current status message and LED state for each partition.  These can be accessed
 // directly in the sketch to get data that is not already tracked in the library.  See dscPrintPanelMessages() and
@@ -148,9 +414,230 @@ byte dscLights[dscPartitions];
 
 // Process panel and keypad/module data
 void dscPanelLoop();
-bool dscHandleModule();  // Returns true if data is available
+bool dscProcessPanelCommand();  // Filters and processes dscPanelData, returns true if the command is new data for the sketch
+bool dscCheckKeybus();           // Updates dscKeybusConnected, returns true if it changed
+
+// Structured decoding - dscDecodePanel() fills a dscDecodedPanel with the data printed by dscPrintPanelMessage(), and
+// dscDecodeModule() a dscDecodedModule with the data printed by dscPrintModuleMessage().  The type selects which
+// fields are set, all other fields are 0.  See dscKeybusDecodeData-RTOS.c for the commands decoded to each type.
+enum dscDecodeType {
+  DSC_DECODE_UNKNOWN,            // Not decoded, or the CRC is not valid
+  DSC_DECODE_STATUS,             // partition[] lights and messages, zones[] open or lit
+  DSC_DECODE_ZONES,              // zones[] open
+  DSC_DECODE_FLASHING,           // partitions, lights and zones[] flashing
+  DSC_DECODE_ENABLED_ZONES,      // partitions and zones[] enabled - 0xB1 sets partition[].zones for partitions 1-2 instead
+  DSC_DECODE_BEEP,               // partitions, code: number of beeps
+  DSC_DECODE_LONG_BEEP,          // partitions, code: 0x02 if the partition failed to arm
+  DSC_DECODE_BEEP_PATTERN,       // partitions, code: beep pattern as printed by dscPrintPanel_0x75()
+  DSC_DECODE_OUTPUTS,            // outputs
+  DSC_DECODE_EVENT,              // Timestamped message: partitions, date and time, event fields
+  DSC_DECODE_PANEL_INFO,         // code: panel model, detail: zone wiring and panel state, see dscPrintPanel_0x16()
+  DSC_DECODE_KEYPAD_STATUS,      // code: keypad status, see dscPrintPanel_0xC3()
+  DSC_DECODE_QUERY,              // Panel query or verification without data
+  DSC_DECODE_MESSAGE,            // Not yet understood: code and detail as printed
+  DSC_DECODE_KEY,                // Module: partition, code: key
+  DSC_DECODE_KEYPAD_ALARM,       // Module: code: 0x77 fire, 0xBB auxiliary, 0xDD panic
+  DSC_DECODE_SLOTS,              // Module: slots active in response to 0x11
+  DSC_DECODE_SLOT_ZONES,         // Module: slots, slotZonesOpen and slotZonesClosed in response to 0xD5
+  DSC_DECODE_NOTIFICATION        // Module: code: 0xBF zone expander, 0xFE Keybus, 0xFB keypad zone status
+};
+
+// Keypad lights, bit numbers in dscDecodedPartition.lights and dscLights[]
+#define DSC_LIGHT_READY 0
+#define DSC_LIGHT_ARMED 1
+#define DSC_LIGHT_MEMORY 2
+#define DSC_LIGHT_BYPASS 3
+#define DSC_LIGHT_TROUBLE 4
+#define DSC_LIGHT_PROGRAM 5
+#define DSC_LIGHT_FIRE 6
+#define DSC_LIGHT_BACKLIGHT 7
+
+// Panel outputs, bit numbers in dscDecodedPanel.outputs
+#define DSC_OUTPUT_BELL 0
+#define DSC_OUTPUT_PGM1 1
+#define DSC_OUTPUT_PGM2 2
+#define DSC_OUTPUT_PGM3 3
+#define DSC_OUTPUT_PGM4 4
+
+// Timestamped messages with a zone, keypad slot, or access code - other messages are DSC_PANEL_EVENT_OTHER and
+// identified by eventGroup and eventCode
+enum dscPanelEventType {
+  DSC_PANEL_EVENT_OTHER,
+  DSC_PANEL_EVENT_TIMESTAMP,              // Date and time only
+  DSC_PANEL_EVENT_ZONE_ALARM,             // zone
+  DSC_PANEL_EVENT_ZONE_ALARM_RESTORED,    // zone
+  DSC_PANEL_EVENT_ZONE_TAMPER,            // zone
+  DSC_PANEL_EVENT_ZONE_TAMPER_RESTORED,   // zone
+  DSC_PANEL_EVENT_ZONE_FAULT,             // zone
+  DSC_PANEL_EVENT_ZONE_FAULT_RESTORED,    // zone
+  DSC_PANEL_EVENT_ZONE_BYPASSED,          // zone
+  DSC_PANEL_EVENT_ARMED,                  // accessCode
+  DSC_PANEL_EVENT_DISARMED,               // accessCode
+  DSC_PANEL_EVENT_AUTO_ARM_CANCELLED,     // accessCode
+  DSC_PANEL_EVENT_SUPERVISORY_RESTORED,   // zone: keypad slot
+  DSC_PANEL_EVENT_SUPERVISORY_TROUBLE     // zone: keypad slot
+};
+
+typedef struct {
+  byte number;    // Partition 1-8, 0 if the command does not identify the partition
+  byte lights;    // Keypad lights as DSC_LIGHT_* bits
+  byte message;   // Status message, see dscPrintPanelMessages()
+  bool disabled;  // The partition is not in use
+  byte zones[4];  // Enabled zones 1-32 as bit flags, set by 0xB1
+} dscDecodedPartition;
+
+typedef struct {
+  byte type;                          // DSC_DECODE_*
+  byte command;                       // dscPanelData[0]
+  byte subcommand;                    // 0xE6 subcommand, 0 for other commands
+  byte partitions;                    // Partitions as bit flags - bit 0 is partition 1, 0 if the command is not for a partition
+  byte partitionCount;                // Entries in partition[]
+  dscDecodedPartition partition[4];
+  byte lights;                        // Flashing keypad lights as DSC_LIGHT_* bits
+  byte zoneStart;                     // Zone number of bit 0 in zones[0]
+  byte zoneBytes;                     // Bytes used in zones[]
+  byte zones[8];                      // Zones as bit flags
+  byte outputs;                       // Panel outputs as DSC_OUTPUT_* bits
+  byte code, detail;                  // Set by type
+  int year;                           // Date and time for DSC_DECODE_EVENT
+  byte month, day, hour, minute;
+  byte eventGroup;                    // Message table and code, see dscPrintPanelStatus0() and neighbours
+  byte eventCode;
+  byte eventType;                     // DSC_PANEL_EVENT_*
+  byte zone;                          // Zone or keypad slot for zone and supervisory events
+  byte accessCode;                    // Access code for armed, disarmed, and auto-arm cancelled events
+} dscDecodedPanel;
+
+typedef struct {
+  byte type;                          // DSC_DECODE_*
+  byte panelCommand;                  // dscModuleCmd
+  byte partition;                     // Partition of a key, 0 if not identified
+  byte code;                          // Set by type
+  byte slots;                         // Keypad slots as bit flags - bit 0 is slot 1
+  byte slotZonesOpen;                 // Keypad slots reporting the keypad zone open
+  byte slotZonesClosed;               // Keypad slots reporting the keypad zone closed
+} dscDecodedModule;
+
+// Panel command descriptors - dscPanelCommands[] is indexed by the command byte and dscPanelCommandsE6[] by the 0xE6
+// subcommand in byte 2.  Options set how redundant data is handled and if the command requires a valid CRC.
+typedef struct {
+  void (*process)();                        // Processes status, NULL if the command status is not tracked
+  void (*print)();                          // Prints the decoded message, NULL if the command is not decoded
+  void (*decode)(dscDecodedPanel *decoded);  // Fills the structured message, NULL if the command is not decoded
+  uint32_t options;                         // dscCmd flags, bytes compared for redundant data, and redundant data history slot
+} dscCommand;
+
+#define dscCmdRedundantMask 0x03
+#define dscCmdRedundant 0x01                                   // Skipped if unchanged - sent constantly in installer programming
+#define dscCmdPeriodic 0x02                                    // Skipped if unchanged unless dscProcessRedundantData is set
+#define dscCmdCRC 0x04                                         // Processed and printed only with a valid CRC
+#define dscCmdExtended 0x08                                    // Subcommand in byte 2 is looked up in dscPanelCommandsE6[]
+#define dscCmdRepeat 0x10                                      // Repeated by the panel as new data (beeps), never skipped by dscSkipRedundantCommands
+#define dscCmdBytes(bytes) ((uint32_t)(bytes) << 8)           // Bytes compared for redundant data, 0 compares dscReadSize
+#define dscCmdGetBytes(options) (((options) >> 8) & 0xFF)
+#define dscCmdSlot(slot) ((uint32_t)(slot) << 16)             // Redundant data history slot
+#define dscCmdGetSlot(options) (((options) >> 16) & 0xFF)
+
+extern const dscCommand dscPanelCommands[256];
+extern const dscCommand dscPanelCommandsE6[256];
+const dscCommand* dscPanelCommand();  // Returns the descriptor for the command in dscPanelData
+bool dscHandleModule();  // Moves dscModuleData to the next buffered response, returns false if no data is available
 
 volatile bool dscBufferOverflow;
+void dscHealthSnapshot(dscHealthCounters *counters);  // Copies the health counters without a partial update from dscDataInterrupt()
+void dscHealthReset();
+byte dscPanelBufferCapacity();  // Number of commands the panel buffer holds
+
+// Panel buffer sizing with dscBufferAllocate set - set before dscBegin().  Compare dscHealthCounters.bufferHighWater
+// to dscPanelBufferCapacity() to find the size needed for an installation.
+#if dscBufferAllocate
+byte dscPanelBufferFrames;   // Commands to buffer if the sketch is busy (253 max), 0 for dscBufferSize
+byte dscPanelBufferReserve;  // Commands added once after the first overflow, allocated only when needed - 0 to never grow
+#endif
+
+// Structured decoding
+bool dscDecodePanel(dscDecodedPanel *decoded);    // Decodes dscPanelData, returns false if the command is not decoded or the CRC is not valid
+bool dscDecodeModule(dscDecodedModule *decoded);  // Decodes dscModuleData
+
+const char *dscPanelMessageText(byte message);         // Status message text, for example dscDecodedPartition.message - NULL if unknown
+const char *dscPanelEventText(byte group, byte code);  // Timestamped message text without a zone or code number - NULL if unknown
+
+// Keybus trace capture - dscTraceBegin() queues each command to dscTraceQueue, a task encodes the records with
+// dscTraceEncode() to send to serial or a network socket.  dscTraceDecode() and dscTraceLoad() read a trace to print
+// offline.
+void dscTraceBegin();
+QueueHandle_t dscTraceQueue;
+byte dscTraceEncode(const dscTraceRecord *record, uint32_t *previousTime, byte *output);  // Returns the encoded length
+int dscTraceDecode(const byte *input, int length, uint32_t *previousTime, dscTraceRecord *record);  // Returns the record length, 0 if incomplete, -1 if invalid
+void dscTraceLoad(const dscTraceRecord *record);  // Points dscPanelData or dscModuleData to the record
+
+// Latency statistics - with dscLatencyStats set, each command is timed with dscCycleCount() at each stage from its
+// final clock edge to the sketch.  The sketch marks when its task wakes for dscDataAvailable and when it has sent a
+// notification for the command, for example:
+//   xSemaphoreTake(dscDataAvailable, portMAX_DELAY);
+//   dscLatencyMark(DSC_LATENCY_WAKEUP);
+//   ...
+//   homekit_characteristic_notify(...);
+//   dscLatencyMark(DSC_LATENCY_NOTIFY);
+#if dscLatencyStats
+enum dscLatencyStage {
+  DSC_LATENCY_CAPTURE,    // Final clock edge to the command stored in the panel buffer by dscDataInterrupt(), includes the Keybus reset
+  DSC_LATENCY_QUEUE,      // Panel buffer to dscPanelLoop()
+  DSC_LATENCY_PROCESS,    // Filtering and status processing in dscPanelLoop()
+  DSC_LATENCY_WAKEUP,     // dscDataAvailable to the sketch task woken
+  DSC_LATENCY_NOTIFY,     // Sketch task woken to the notification sent
+  DSC_LATENCY_AVAILABLE,  // Final clock edge to dscDataAvailable
+  DSC_LATENCY_TOTAL,      // Final clock edge to the notification sent
+  DSC_LATENCY_STAGES
+};
+
+typedef struct {
+  uint32_t count;
+  uint32_t min, mean, p99, max;  // Microseconds
+} dscLatencySummary;
+
+void dscLatencyMark(byte stage);  // Records DSC_LATENCY_WAKEUP or DSC_LATENCY_NOTIFY for the command in dscPanelData
+bool dscLatencyRead(int command, byte stage, dscLatencySummary *summary);  // Command byte or -1 for all commands, returns false if there are no samples
+void dscLatencyReset();
+void dscLatencyPrint();  // Prints min/mean/p99/max for each stage with dscPrintf()
+void dscLatencyDumpBegin(uint32_t interval, UBaseType_t priority);  // Prints the latency every interval ms from a task at this priority
+#endif
+
+// Interrupt profiling - with dscIsrProfile set, each call of dscClockInterrupt() and dscDataInterrupt() is timed with
+// dscCycleCount() from entry to exit of the handler and counted by the path it took.  The CPU share is the time spent
+// in the handlers during the last complete second - the interrupt dispatch before and after the handlers is not
+// included.
+#if dscIsrProfile
+enum dscIsrPath {
+  DSC_ISR_CLOCK,   // dscClockInterrupt() without a virtual keypad write
+  DSC_ISR_WRITE,   // dscClockInterrupt() writing a virtual keypad bit
+  DSC_ISR_PANEL,   // dscDataInterrupt() reading a panel bit
+  DSC_ISR_MODULE,  // dscDataInterrupt() reading a keypad/module bit
+  DSC_ISR_COMMIT,  // dscDataInterrupt() at the end of a command: filtering, publishing to the buffers, notifying dscPanelLoop()
+  DSC_ISR_PATHS
+};
+
+typedef struct {
+  uint32_t count;           // Calls since dscBegin() or dscIsrProfileReset()
+  uint32_t mean, max;       // Cycles per call
+  uint32_t callsPerSecond;  // Calls in the last complete second
+  uint32_t share;           // CPU time in the last complete second, in 0.01% units
+} dscIsrSummary;
+
+bool dscIsrProfileRead(int path, dscIsrSummary *summary);  // Path or -1 for all paths, returns false if there are no calls
+void dscIsrProfileReset();
+void dscIsrProfilePrint();  // Prints the calls, cycles, and CPU share of each path with dscPrintf()
+#endif
+
+// Status snapshots
+void dscSnapshot(dscStatusSnapshot *snapshot);  // Copies the current status without a partial update from dscPanelLoop()
+uint32_t dscDiff(const dscStatusSnapshot *previous, const dscStatusSnapshot *current);  // Returns the changed status as dscEventBit(DSC_EVENT_*) flags
+SemaphoreHandle_t dscStatusMutex;  // Held by dscPanelLoop() while processing a command
+
+// Status events
+int dscSubscribe(uint32_t mask);  // Subscribes the calling task to events, returns the subscriber or -1 if dscSubscribers are in use
+bool dscReadEvent(int subscriber, dscEvent *event, TickType_t ticksToWait);  // Returns false if no event was read before the timeout
+dscSubscriber dscEventSubscribers[dscSubscribers];
 
 // dscKeybusInterface library private
 void dscProcessPanelStatus();
@@ -162,7 +649,6 @@ void dscProcessPanel_0x2D();
 void dscProcessPanel_0x34();
 void dscProcessPanel_0x3E();
 void dscProcessPanel_0xA5();
-void dscProcessPanel_0xE6();
 void dscProcessPanel_0xE6_0x09();
 void dscProcessPanel_0xE6_0x0B();
 void dscProcessPanel_0xE6_0x0D();
@@ -233,38 +719,307 @@ void dscPrintModule_Panel_0xD5();
 void dscPrintModule_Notification();
 void dscPrintModule_Keys();
 
+void dscDecodePanelPartition(dscDecodedPanel *decoded, byte partition, byte dscPanelByte);
+void dscDecodePanelZones(dscDecodedPanel *decoded, byte dscPanelByte, byte zoneBytes, byte zoneStart);
+void dscDecodePanelStatusZones(dscDecodedPanel *decoded, byte zoneStart);
+void dscDecodePanelStatusLights(dscDecodedPanel *decoded, byte zoneStart);
+void dscDecodePanelFlashing(dscDecodedPanel *decoded, byte partitions);
+void dscDecodePanelBeep(dscDecodedPanel *decoded, byte partitions, byte dscPanelByte);
+void dscDecodePanelBeepPattern(dscDecodedPanel *decoded, byte partitions, byte dscPanelByte);
+void dscDecodePanelLongBeep(dscDecodedPanel *decoded, byte partitions);
+void dscDecodePanelTime(dscDecodedPanel *decoded, byte dscPanelByte);
+byte dscDecodeAccessCode(byte offset);
+void dscDecodePanelEvent(dscDecodedPanel *decoded, byte group, byte code);
+void dscDecodePanelQuery(dscDecodedPanel *decoded);
+void dscDecodePanelMessage(dscDecodedPanel *decoded);
+void dscDecodePanel_0x05(dscDecodedPanel *decoded);
+void dscDecodePanel_0x0A(dscDecodedPanel *decoded);
+void dscDecodePanel_0x16(dscDecodedPanel *decoded);
+void dscDecodePanel_0x1B(dscDecodedPanel *decoded);
+void dscDecodePanel_0x27(dscDecodedPanel *decoded);
+void dscDecodePanel_0x2D(dscDecodedPanel *decoded);
+void dscDecodePanel_0x34(dscDecodedPanel *decoded);
+void dscDecodePanel_0x3E(dscDecodedPanel *decoded);
+void dscDecodePanel_0x5D(dscDecodedPanel *decoded);
+void dscDecodePanel_0x63(dscDecodedPanel *decoded);
+void dscDecodePanel_0x64(dscDecodedPanel *decoded);
+void dscDecodePanel_0x69(dscDecodedPanel *decoded);
+void dscDecodePanel_0x75(dscDecodedPanel *decoded);
+void dscDecodePanel_0x7A(dscDecodedPanel *decoded);
+void dscDecodePanel_0x7F(dscDecodedPanel *decoded);
+void dscDecodePanel_0x82(dscDecodedPanel *decoded);
+void dscDecodePanel_0x87(dscDecodedPanel *decoded);
+void dscDecodePanel_0x94(dscDecodedPanel *decoded);
+void dscDecodePanel_0xA5(dscDecodedPanel *decoded);
+void dscDecodePanel_0xB1(dscDecodedPanel *decoded);
+void dscDecodePanel_0xBB(dscDecodedPanel *decoded);
+void dscDecodePanel_0xC3(dscDecodedPanel *decoded);
+void dscDecodePanel_0xCE(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x03(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x09(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x0B(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x0D(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x0F(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x17(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x18(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x19(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x1D(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x20(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x41(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x2B(dscDecodedPanel *decoded);
+void dscDecodePanel_0xE6_0x2C(dscDecodedPanel *decoded);
+void dscDecodePanel_0xEB(dscDecodedPanel *decoded);
+
+// Keybus capture
 bool dscValidCRC();
-void dscSetWriteKey(int receivedKey);
-bool dscRedundantPanelData(byte dscPreviousCmd[], volatile byte dscCurrentCmd[], byte checkedBytes);
+byte dscPanelBitCount, dscPanelByteCount;
+byte dscModuleBitCount, dscModuleByteCount;
+volatile byte dscCurrentCmd, dscStatusCmd;
+volatile byte *dscIsrPanelData, dscIsrPanelBitTotal, dscIsrPanelBitCount, dscIsrPanelByteCount;
+volatile byte *dscIsrModuleData, dscIsrModuleBitTotal, dscIsrModuleBitCount, dscIsrModuleByteCount;
+volatile unsigned long dscClockHighTime, dscKeybusTime;
+dscHealthCounters dscHealth;  // Updated by dscDataInterrupt() and dscPanelLoop()
 
-const char* dscPanelKeysArray;
-volatile bool dscPanelKeyPending, dscPanelKeysPending;
-bool dscWriteArm[dscPartitions];
+// Panel buffer: single-producer/single-consumer ring - dscDataInterrupt() captures each command in place in the head
+// slot and only writes the head, dscPanelLoop() only writes the tail (next command to process) and the release index
+// (oldest slot still in use by dscPanelData).  The extra slots hold the command being captured and dscPanelData.
+#define dscBufferSlots (dscBufferSize + 2)
+volatile byte dscPanelBufferHead, dscPanelBufferTail, dscPanelBufferRelease;
+byte dscPanelBufferCount();  // Number of commands waiting in the panel buffer
+#if dscBufferAllocate
+dscFrame *dscPanelBuffer;
+volatile byte dscPanelBufferSlots;
+volatile bool dscPanelBufferGrow;  // Set by dscDataInterrupt() on the first overflow if dscPanelBufferReserve is set
+dscFrame *dscPanelBufferRetired;   // Buffer replaced by dscGrowPanelBuffer() that dscPanelData may still point into
+bool dscPanelBufferRetiredGiven;   // Set once the sketch is given a command from the new buffer
+void dscGrowPanelBuffer();
+void dscFreeRetiredBuffer();
+#else
+#define dscPanelBufferSlots dscBufferSlots
+dscFrame dscPanelBuffer[dscBufferSlots];
+#endif
+SemaphoreHandle_t dscPanelDataReleased;
+
+// Module buffer: same single-producer/single-consumer ring as the panel buffer - dscHandleModule() writes the tail and
+// the release index (oldest slot still in use by dscModuleData)
+#define dscModuleBufferSlots (dscModuleBufferSize + 2)
+volatile byte dscModuleBufferHead, dscModuleBufferTail, dscModuleBufferRelease;
+dscModuleFrame dscModuleBuffer[dscModuleBufferSlots];
+
+// Redundant data filtering - history of the last command, one slot per command with a redundant data option
+enum {
+  dscHistory0A, dscHistory11, dscHistory16, dscHistory27, dscHistory2D, dscHistory34, dscHistory3E,
+  dscHistory5D, dscHistory63, dscHistoryB1, dscHistoryC3, dscHistoryE6_03, dscHistoryE6_20,
+  dscHistorySlots
+};
+#if dscRedundantDataHash
+#define dscHashBasis 2166136261UL
+#define dscHashByte(hash, value) (((hash) ^ (value)) * 16777619UL)  // FNV-1a
+#define dscHashCacheSize 64  // Commands tracked by dscSkipRedundantCommands, must be a power of 2
+uint32_t dscPanelDataHash(const byte dscData[], byte length);
+uint32_t dscCommandHistory[dscHistorySlots];
+struct {
+  uint16_t command;  // Command in the high byte, 0xE6 subcommand in the low byte
+  uint32_t hash;
+} dscHashCache[dscHashCacheSize];
+volatile uint32_t dscIsrPanelHash;
+#else
+byte dscCommandHistory[dscHistorySlots][dscReadSize];
+#endif
+bool dscRedundantPanelData(byte dscPreviousCmd[], const volatile byte dscCurrentCmd[], byte checkedBytes);
+
+// Status tracking
 bool dscPreviousTrouble;
 bool dscPreviousKeybus;
 byte dscPreviousAccessCode[dscPartitions];
 byte dscPreviousLights[dscPartitions], dscPreviousStatus[dscPartitions];
-bool dscPreviousReady[dscPartitions];
-bool dscPreviousExitDelay[dscPartitions], dscPreviousEntryDelay[dscPartitions];
+uint16_t dscPreviousPartitionStatus[dscPartitions];
 byte dscPreviousExitState[dscPartitions];
-bool dscPreviousArmed[dscPartitions], dscPreviousArmedStay[dscPartitions];
-bool dscPreviousAlarm[dscPartitions];
-bool dscPreviousFire[dscPartitions];
 byte dscPreviousOpenZones[dscZones], dscPreviousAlarmZones[dscZones];
+#define dscArmedState(partition) (dscArmed(partition) ? (dscArmedAway(partition) ? DSC_EXIT_AWAY : DSC_EXIT_STAY) : 0)
+
+// Status events
+void dscEmitEvent(byte type, byte index, byte state);
+dscEvent dscEventLog[dscEventLogSize];    // Shared by all subscribers, written only by dscPanelLoop
+volatile uint32_t dscEventLogHead;        // Sequence number of the next event written to dscEventLog
+volatile byte dscSubscriberCount;
+uint32_t dscEventMask;                    // Events selected by any subscriber
 
+// Trace capture
+void dscTraceFrame(const byte *data, byte bitCount, byte byteCount, uint32_t time, byte flags, byte panelCommand);
+volatile bool dscTraceOverflow;  // Set by dscDataInterrupt() when a command is dropped
+
+// Write
+bool dscSetWriteKey(int receivedKey);
+int dscKeyCode(int receivedKey, byte *flags);  // Returns the Keybus code for the key, or -1 if the key is not valid
+void dscSetWritePosition(byte partition);
+byte dscWriteSequence(const char *keys);
+bool dscWaitKeyWritten();
+void dscWriteLoop(void *parameters);
+
+volatile bool dscPanelKeyPending;
+volatile byte dscWriteStatusCmd;  // Status command with the write position for the partition of the pending key
+#define dscKeyAlarm 0x01           // Key flags set by dscKeyCode()
+#define dscKeyAsterisk 0x02
+#define dscKeyArm 0x04
+#if dscWritePipeline
+#define dscKeyFifoSize 8  // Keys queued for dscClockInterrupt() per partition, must be a power of 2
+#define DSC_WRITE_PENDING 0xFF  // Returned by dscWriteStep() until the keys are written
+typedef struct {
+  byte key, flags;
+} dscKeyEntry;
+typedef struct {
+  dscKeyEntry fifo[dscKeyFifoSize];
+  volatile byte head, tail;  // The head is written by dscWriteStep(), the tail by dscLoadKeys()
+  volatile byte key, flags;  // Key loaded by dscLoadKeys()
+  volatile bool pending;     // Set until the key is written, or until the panel responds to '*' with 0x9E
+  volatile bool asterisk;    // '*' is written, waiting for 0x9E
+  bool claimed;              // Set while a sequence is writing to the partition
+  byte retries;              // Writes of the key after it was not read back as written
+  bool mismatch;             // Set by dscVerifyKey() if a write of the key was not read back as written
+  volatile bool failed;      // Set by dscVerifyKey() after dscWriteRetries retries, stops loading keys until cleared
+  unsigned long loadTime;    // millis() when the key was loaded, for dscHealth.writeLatency
+} dscKeyQueue;
+dscKeyQueue dscKeyFifo[dscPartitions];
+volatile byte dscWriteAlarmPartition;  // Partition of the alarm key written by dscClockInterrupt(), or 0
+volatile byte dscWriteEchoBit, dscWriteEchoPartition, dscWriteEcho;  // Key being read back by dscDataInterrupt()
+volatile bool dscWriteEchoLast;  // Set unless the write is the first of an alarm key
+typedef struct {
+  const char *keys;
+  byte index, partition, keyCount;
+  bool claimed;
+  byte previousTail;
+  bool previousPending;
+  TickType_t progressTime;  // Last time dscClockInterrupt() loaded or wrote a key of the sequence
+} dscWriteProgress;
+QueueHandle_t dscWriteQueues[dscPartitions];
+TaskHandle_t dscWriteLoopHandle;
+void dscWriteBegin(dscWriteProgress *progress, const char *keys, byte partition);
+byte dscWriteStep(dscWriteProgress *progress);
+bool dscClaimKeys(byte partitionIndex);
+void dscReleaseKeys(byte partitionIndex);
+void dscCancelKeys(byte partitionIndex);
+void dscWriteActive(bool active);
+void dscLoadKeys(bool writeRepeat);
+void dscVerifyKey();
+byte dscWriteSlot(byte byteCount, byte *writeBit);
+#endif
+SemaphoreHandle_t dscWriteMutex;  // Held while writing keys so sequences from different tasks are not interleaved
+typedef struct {
+  char keys[dscWriteKeysSize];
+  byte partition;
+  dscWriteCallback callback;
+  void *context;
+} dscWriteRequest;
+bool dscWriteArm[dscPartitions];
 byte dscWriteByte, dscWriteBit;
 bool dscVirtualKeypad;
 byte dscPanelKey;
-byte dscPanelBitCount, dscPanelByteCount;
 volatile bool dscWriteAlarm, dscWriteAsterisk, dscWroteAsterisk;
-volatile bool dscModuleDataCaptured;
-volatile unsigned long dscClockHighTime, dscKeybusTime;
-volatile byte dscPanelBufferLength;
-volatile byte dscPanelBuffer[dscBufferSize][dscReadSize];
-volatile byte dscPanelBufferBitCount[dscBufferSize], dscPanelBufferByteCount[dscBufferSize];
-volatile byte dscModuleBitCount, dscModuleByteCount;
-volatile byte dscCurrentCmd, dscStatusCmd;
-volatile byte dscIsrPanelData[dscReadSize], dscIsrPanelBitTotal, dscIsrPanelBitCount, dscIsrPanelByteCount;
-volatile byte dscIsrModuleData[dscReadSize], dscIsrModuleBitTotal, dscIsrModuleBitCount, dscIsrModuleByteCount;
+
+// Commands
+#define dscAccessCodeLength 8  // Maximum digits of an access code written by a command
+#define DSC_COMMAND_IDLE 0
+#define DSC_COMMAND_WRITING 1     // Keys queued with dscWriteAsync()
+#define DSC_COMMAND_CONFIRMING 2  // Keys written, waiting for the target state
+#define DSC_COMMAND_ARM 0
+#define DSC_COMMAND_DISARM 1
+#define DSC_COMMAND_KEYS 2        // Completes when the keys are written
+#define DSC_COMMAND_BYPASS 3      // Completes when the # after the last zone is written
+typedef struct {
+  volatile byte state;
+  byte type, partition;
+  volatile bool prompt;    // Set by dscCommandPrompt() for 0x9F
+  volatile bool rejected;  // Set by dscCommandRejected() for 0x8F
+  bool codeWritten;
+  bool keysPending;        // Zones of a bypass left to queue after the current sequence
+  byte zones[dscZones];    // Zones of a bypass not yet queued
+  char accessCode[dscAccessCodeLength + 1];
+  TickType_t startTime;
+  dscWriteCallback callback;
+  void *context;
+} dscCommandState;
+dscCommandState dscCommandStates[dscPartitions];
+bool dscCommandBegin(byte partition, byte type, const char *keys, const char *accessCode, dscWriteCallback callback, void *context);
+dscCommandState *dscCommandClaim(byte partition, byte type, const char *accessCode, dscWriteCallback callback, void *context);
+void dscBypassKeys(dscCommandState *command, char *keys, byte *length);
+void dscCommandWritten(byte result, void *context);
+bool dscCommandStep();
+void dscCommandFinish(dscCommandState *command, byte result);
+bool dscCommandPrompt(byte partitionIndex);
+void dscCommandRejected(byte partitionIndex);
+bool dscTimeCommandBegin(unsigned int year, byte month, byte day, byte hour, byte minute, const char *accessCode, dscWriteCallback callback, void *context);
+bool dscTimeKeys(char *keys, unsigned int year, byte month, byte day, byte hour, byte minute, const char *accessCode);
+bool dscAddKeys(char *keys, byte *length, const char *add);
+bool dscAddCode(char *keys, byte *length, const char *accessCode);
+bool dscValidAccessCode(const char *accessCode);
+bool dscAddNumber(char *keys, byte *length, unsigned int value, byte digits);
+
+// Print output
+#define dscPrintfSize 96  // Longest output of a single dscPrintf() to an output sink
+
+char dscPrintRing[dscPrintRingSize];
+volatile uint32_t dscPrintRingHead, dscPrintRingTail;  // Free-running, masked to the ring size
+TaskHandle_t dscPrintDrainHandle;
+SemaphoreHandle_t dscPrintMutex;  // Held by dscPrintToRing() while copying to dscPrintRing
+char *dscPrintBuffer;
+int dscPrintBufferSize;
+void dscPrintDrain(void *parameters);
+
+// Fixed message strings - dscStringTable() expands a list of (status byte, text) entries to the strings and a table
+// of string numbers indexed by the status byte, for lookups in constant time without a pointer per status byte
+#define dscStringId(p, code, text) p##code,
+#define dscStringText(p, code, text) text,
+#define dscStringIndex(p, code, text) [code] = p##code,
+#define dscStringTable(name, list)                                     \
+  enum { name##None, list(dscStringId, name##_) };                     \
+  const char *const name##Strings[] = { NULL, list(dscStringText, ) }; \
+  const byte name##Index[256] = { list(dscStringIndex, name##_) };
+#define dscStringLookup(name, code) name##Strings[name##Index[code]]
+
+// Latency statistics
+#if dscLatencyStats
+#define dscLatencyBuckets 64  // Two buckets per power of 2 of the cycle count
+typedef struct {
+  uint32_t count, min, max;  // Cycles
+  uint64_t sum;
+  uint16_t buckets[dscLatencyBuckets];
+} dscLatencyHistogram;
+dscLatencyHistogram dscLatencyAll[DSC_LATENCY_STAGES];
+dscLatencyHistogram dscLatencyByCommand[dscLatencyCommands][DSC_LATENCY_STAGES];
+byte dscLatencyCommandList[dscLatencyCommands], dscLatencyCommandCount;
+byte dscLatencyCommand, dscLatencyMarked;  // Command most recently made available to the sketch, stages marked
+bool dscLatencyStarted;
+uint32_t dscLatencyEdge, dscLatencyGiven, dscLatencyWoken;
+volatile uint32_t dscIsrEdgeCycles;
+uint32_t dscLatencyDumpInterval;
+TaskHandle_t dscLatencyDumpHandle;
+void dscLatencyFrame(const dscFrame *frame, uint32_t readCycles, bool available);
+void dscLatencyRecord(byte command, byte stage, uint32_t cycles);
+void dscLatencyAdd(dscLatencyHistogram *histogram, uint32_t cycles);
+byte dscLatencyBucket(uint32_t cycles);
+uint32_t dscLatencyBucketLimit(byte bucket);
+void dscLatencyDump(void *parameters);
+#endif
+
+// Interrupt profiling
+#if dscIsrProfile
+typedef struct {
+  uint32_t count, max;
+  uint64_t cycles;
+  uint32_t windowCount, windowCycles;  // Current second
+  uint32_t secondCount, secondCycles;  // Last complete second
+} dscIsrCounters;
+dscIsrCounters dscIsrProfilePaths[DSC_ISR_PATHS];
+uint32_t dscIsrProfileWindowStart, dscIsrProfileSecond;  // Cycles
+void dscIsrProfileAdd(byte path, uint32_t startCycles);
+#define dscIsrProfileStart(path) uint32_t isrStartCycles = dscCycleCount(); byte isrPath = path
+#define dscIsrProfilePath(path) isrPath = path
+#define dscIsrProfileEnd() dscIsrProfileAdd(isrPath, isrStartCycles)
+#else
+#define dscIsrProfileStart(path)
+#define dscIsrProfilePath(path)
+#define dscIsrProfileEnd()
+#endif
 
 #endif  // dscKeybusInterface_h
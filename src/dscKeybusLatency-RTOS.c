@@ -0,0 +1,238 @@
+/*
+    DSC Keybus Interface
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dscKeybusInterface-RTOS.h"
+
+#if dscLatencyStats
+
+/*
+ *  Latency statistics - each command is timed with the CPU cycle counter:
+ *
+ *    dscClockInterrupt()  final clock edge of the command          frame->edgeCycles
+ *    dscDataInterrupt()   command stored in the panel buffer       frame->cycles
+ *    dscPanelLoop()       command read from the panel buffer       readCycles
+ *    dscPanelLoop()       command processed, dscDataAvailable      dscLatencyGiven
+ *    dscLatencyMark()     sketch task woken, notification sent
+ *
+ *  Each stage is recorded in a histogram for all commands and in a histogram for the command byte, for the first
+ *  dscLatencyCommands command bytes received.  Histogram buckets are half powers of 2 of the cycle count, so the p99
+ *  is reported as the upper bound of its bucket - up to 50% above the actual value, never below it.
+ */
+
+
+// Records the stages of the command read by dscPanelLoop() at readCycles, called after the command is processed
+void dscLatencyFrame(const dscFrame *frame, uint32_t readCycles, bool available) {
+  uint32_t now = dscCycleCount();
+  byte command = frame->data[0];
+
+  taskENTER_CRITICAL();
+  dscLatencyRecord(command, DSC_LATENCY_CAPTURE, frame->cycles - frame->edgeCycles);
+  dscLatencyRecord(command, DSC_LATENCY_QUEUE, readCycles - frame->cycles);
+  dscLatencyRecord(command, DSC_LATENCY_PROCESS, now - readCycles);
+
+  // Starts the sketch stages for dscLatencyMark()
+  if (available) {
+    dscLatencyRecord(command, DSC_LATENCY_AVAILABLE, now - frame->edgeCycles);
+    dscLatencyCommand = command;
+    dscLatencyEdge = frame->edgeCycles;
+    dscLatencyGiven = now;
+    dscLatencyWoken = now;
+    dscLatencyMarked = 0;
+    dscLatencyStarted = true;
+  }
+  taskEXIT_CRITICAL();
+}
+
+
+// Records the time from the previous stage of the command most recently made available to the sketch - each stage is
+// recorded once per command.  Without dscRetainPanelData, a mark made after dscPanelLoop() has made the next command
+// available is recorded for the next command.
+void dscLatencyMark(byte stage) {
+  uint32_t now = dscCycleCount();
+
+  taskENTER_CRITICAL();
+  if (dscLatencyStarted && !(dscLatencyMarked & (1 << stage))) {
+    dscLatencyMarked |= 1 << stage;
+
+    switch (stage) {
+      case DSC_LATENCY_WAKEUP:
+        dscLatencyRecord(dscLatencyCommand, DSC_LATENCY_WAKEUP, now - dscLatencyGiven);
+        dscLatencyWoken = now;
+        break;
+
+      case DSC_LATENCY_NOTIFY:
+        dscLatencyRecord(dscLatencyCommand, DSC_LATENCY_NOTIFY, now - dscLatencyWoken);
+        dscLatencyRecord(dscLatencyCommand, DSC_LATENCY_TOTAL, now - dscLatencyEdge);
+        break;
+    }
+  }
+  taskEXIT_CRITICAL();
+}
+
+
+// Adds a sample to the histograms for all commands and for the command byte, called in a critical section
+void dscLatencyRecord(byte command, byte stage, uint32_t cycles) {
+  dscLatencyAdd(&dscLatencyAll[stage], cycles);
+
+  for (byte i = 0; i < dscLatencyCommandCount; i++) {
+    if (dscLatencyCommandList[i] == command) {
+      dscLatencyAdd(&dscLatencyByCommand[i][stage], cycles);
+      return;
+    }
+  }
+
+  if (dscLatencyCommandCount < dscLatencyCommands) {
+    dscLatencyCommandList[dscLatencyCommandCount] = command;
+    dscLatencyAdd(&dscLatencyByCommand[dscLatencyCommandCount++][stage], cycles);
+  }
+}
+
+
+void dscLatencyAdd(dscLatencyHistogram *histogram, uint32_t cycles) {
+  if (histogram->count == 0 || cycles < histogram->min) histogram->min = cycles;
+  if (cycles > histogram->max) histogram->max = cycles;
+  histogram->count++;
+  histogram->sum += cycles;
+
+  // Halves all buckets when a bucket is full - the distribution is kept and recent samples keep their weight
+  byte bucket = dscLatencyBucket(cycles);
+  if (histogram->buckets[bucket] == 0xFFFF) {
+    for (byte i = 0; i < dscLatencyBuckets; i++) histogram->buckets[i] >>= 1;
+  }
+  histogram->buckets[bucket]++;
+}
+
+
+// Two buckets per power of 2: 0, 1, 2, 3, 4-5, 6-7, 8-11, 12-15...
+byte dscLatencyBucket(uint32_t cycles) {
+  if (cycles < 4) return cycles;
+  byte power = 31 - __builtin_clz(cycles);
+  return power * 2 + ((cycles >> (power - 1)) & 1);
+}
+
+
+// Highest cycle count in the bucket
+uint32_t dscLatencyBucketLimit(byte bucket) {
+  if (bucket < 4) return bucket;
+  byte power = bucket / 2;
+  return (uint32_t) ((1UL << power) + ((bucket & 1) + 1) * (1UL << (power - 1)) - 1);  // Wraps to 0xFFFFFFFF for the last bucket
+}
+
+
+/*
+ *  Latency statistics API
+ */
+
+
+// Summarizes the stage for the command byte, or for all commands if command is -1.  Returns false if the stage has no
+// samples for the command.
+bool dscLatencyRead(int command, byte stage, dscLatencySummary *summary) {
+  memset(summary, 0, sizeof(dscLatencySummary));
+  if (stage >= DSC_LATENCY_STAGES) return false;
+
+  dscLatencyHistogram histogram;
+  bool found = false;
+  taskENTER_CRITICAL();
+  if (command < 0) {
+    histogram = dscLatencyAll[stage];
+    found = true;
+  }
+  else {
+    for (byte i = 0; i < dscLatencyCommandCount; i++) {
+      if (dscLatencyCommandList[i] == command) {
+        histogram = dscLatencyByCommand[i][stage];
+        found = true;
+        break;
+      }
+    }
+  }
+  taskEXIT_CRITICAL();
+  if (!found || histogram.count == 0) return false;
+
+  uint32_t cyclesPerMicro = sdk_system_get_cpu_freq();
+  summary->count = histogram.count;
+  summary->min = histogram.min / cyclesPerMicro;
+  summary->mean = (histogram.sum / histogram.count) / cyclesPerMicro;
+  summary->max = histogram.max / cyclesPerMicro;
+
+  uint32_t samples = 0;
+  for (byte i = 0; i < dscLatencyBuckets; i++) samples += histogram.buckets[i];
+  uint32_t target = samples - samples / 100;  // 99th percentile, rounded up
+  uint32_t cumulative = 0;
+  for (byte i = 0; i < dscLatencyBuckets; i++) {
+    cumulative += histogram.buckets[i];
+    if (cumulative >= target) {
+      uint32_t limit = dscLatencyBucketLimit(i);
+      if (limit > histogram.max) limit = histogram.max;
+      summary->p99 = limit / cyclesPerMicro;
+      break;
+    }
+  }
+  return true;
+}
+
+
+void dscLatencyReset() {
+  taskENTER_CRITICAL();
+  memset(dscLatencyAll, 0, sizeof(dscLatencyAll));
+  memset(dscLatencyByCommand, 0, sizeof(dscLatencyByCommand));
+  dscLatencyCommandCount = 0;
+  taskEXIT_CRITICAL();
+}
+
+
+// Prints a table of each stage with samples, for all commands and for each command byte
+void dscLatencyPrint() {
+  static const char *stageNames[DSC_LATENCY_STAGES] = {
+    "capture", "queue", "process", "wakeup", "notify", "available", "total"
+  };
+
+  dscPrintf("Latency (us)          count      min     mean      p99      max\n");
+  for (int i = -1; i < dscLatencyCommandCount; i++) {
+    int command = (i < 0) ? -1 : dscLatencyCommandList[i];
+    for (byte stage = 0; stage < DSC_LATENCY_STAGES; stage++) {
+      dscLatencySummary summary;
+      if (!dscLatencyRead(command, stage, &summary)) continue;
+      if (command < 0) dscPrintf("All  ");
+      else dscPrintf("0x%02X ", command);
+      dscPrintf("%-10s %10lu %8lu %8lu %8lu %8lu\n", stageNames[stage], (unsigned long) summary.count,
+                (unsigned long) summary.min, (unsigned long) summary.mean, (unsigned long) summary.p99,
+                (unsigned long) summary.max);
+    }
+  }
+}
+
+
+// Prints the latency table every dscLatencyDumpInterval ms, run as a task by dscLatencyDumpBegin()
+void dscLatencyDump(void *parameters) {
+  (void) parameters;
+  while (1) {
+    vTaskDelay(dscLatencyDumpInterval / portTICK_PERIOD_MS);
+    dscLatencyPrint();
+  }
+}
+
+
+// Starts a task to print the latency table every interval ms
+void dscLatencyDumpBegin(uint32_t interval, UBaseType_t priority) {
+  dscLatencyDumpInterval = interval;
+  if (dscLatencyDumpHandle == NULL) xTaskCreate(dscLatencyDump, "dscLatencyDump", 384, NULL, priority, &dscLatencyDumpHandle);
+}
+
+#endif  // dscLatencyStats
@@ -17,57 +17,161 @@
     along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdarg.h>
+#include <unistd.h>
 #include "dscKeybusInterface-RTOS.h"
 
+
+// Sends the output of the print functions to dscPrintOutput, or to stdout if an output sink is not set
+void dscPrintf(const char *format, ...) {
+  va_list arguments;
+  va_start(arguments, format);
+  if (dscPrintOutput == NULL) vprintf(format, arguments);
+
+  // Most messages are fixed strings and skip formatting
+  else if (strchr(format, '%') == NULL) dscPrintOutput(format, strlen(format));
+  else {
+    char text[dscPrintfSize];
+    int length = vsnprintf(text, sizeof(text), format, arguments);
+    if (length >= (int) sizeof(text)) length = sizeof(text) - 1;
+    if (length > 0) dscPrintOutput(text, length);
+  }
+  va_end(arguments);
+}
+
+
+// Prints a fixed string without parsing it as a format
+void dscPrintText(const char *text) {
+  if (dscPrintOutput == NULL) fputs(text, stdout);
+  else dscPrintOutput(text, strlen(text));
+}
+
+
+/*
+ *  Output sinks - set dscPrintOutput to decode into memory without blocking on the UART
+ */
+
+
+// Buffers output for dscPrintDrain() - output that does not fit in dscPrintRing is dropped and counted in
+// dscPrintDropped rather than blocking the caller.  Tasks printing at the same time are serialized by dscPrintMutex,
+// so the copy does not disable interrupts.
+void dscPrintToRing(const char *text, int length) {
+  bool notify = false;
+
+  xSemaphoreTake(dscPrintMutex, portMAX_DELAY);
+  uint32_t head = dscPrintRingHead;
+  if (length > dscPrintRingSize - (head - dscPrintRingTail)) dscPrintDropped += length;
+  else {
+    notify = (head == dscPrintRingTail);  // The drain task rechecks the ring before it blocks again
+    for (int i = 0; i < length; i++) dscPrintRing[(head + i) & (dscPrintRingSize - 1)] = text[i];
+    dscMemoryBarrier();
+    dscPrintRingHead = head + length;
+  }
+  xSemaphoreGive(dscPrintMutex);
+
+  if (notify && dscPrintDrainHandle != NULL) xTaskNotifyGive(dscPrintDrainHandle);
+}
+
+
+// Writes dscPrintRing to stdout, run as a low priority task by dscPrintDrainBegin()
+void dscPrintDrain(void *parameters) {
+  (void) parameters;
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    while (dscPrintRingTail != dscPrintRingHead) {
+      uint32_t tail = dscPrintRingTail;
+      uint32_t offset = tail & (dscPrintRingSize - 1);
+      uint32_t length = dscPrintRingHead - tail;
+      if (length > dscPrintRingSize - offset) length = dscPrintRingSize - offset;  // Up to the end of the ring
+
+      fwrite(dscPrintRing + offset, 1, length, stdout);
+      dscMemoryBarrier();
+      dscPrintRingTail = tail + length;
+    }
+    fflush(stdout);
+  }
+}
+
+
+// Sets dscPrintOutput to dscPrintRing and starts the task to write it to stdout
+void dscPrintDrainBegin(UBaseType_t priority) {
+  if (dscPrintMutex == NULL) dscPrintMutex = xSemaphoreCreateMutex();
+  if (dscPrintDrainHandle == NULL) xTaskCreate(dscPrintDrain, "dscPrintDrain", 256, NULL, priority, &dscPrintDrainHandle);
+  dscPrintOutput = dscPrintToRing;
+}
+
+
+// Sets dscPrintOutput to a buffer supplied by the sketch, kept null-terminated - output that does not fit is
+// dropped and counted in dscPrintDropped.  Set dscPrintBufferLength to 0 to reuse the buffer.
+void dscPrintBufferBegin(char *buffer, int size) {
+  dscPrintBuffer = buffer;
+  dscPrintBufferSize = size;
+  dscPrintBufferLength = 0;
+  if (size > 0) buffer[0] = '\0';
+  dscPrintOutput = dscPrintToBuffer;
+}
+
+
+void dscPrintToBuffer(const char *text, int length) {
+  int available = dscPrintBufferSize - 1 - dscPrintBufferLength;
+  if (available < 0) available = 0;
+  if (length > available) {
+    dscPrintDropped += length - available;
+    length = available;
+  }
+  memcpy(dscPrintBuffer + dscPrintBufferLength, text, length);
+  dscPrintBufferLength += length;
+  if (dscPrintBufferSize > 0) dscPrintBuffer[dscPrintBufferLength] = '\0';
+}
+
+
+// Writes to the socket in dscPrintSocket, which is set to -1 if the connection fails
+void dscPrintToSocket(const char *text, int length) {
+  if (dscPrintSocket < 0) return;
+  while (length > 0) {
+    int written = write(dscPrintSocket, text, length);
+    if (written <= 0) {
+      dscPrintSocket = -1;
+      return;
+    }
+    text += written;
+    length -= written;
+  }
+}
+
+
+// Counts output in dscPrintCount without writing it, for measuring the print functions
+void dscPrintToNull(const char *text, int length) {
+  (void) text;
+  dscPrintCount += length;
+}
+
+
 /*
  *  Print messages
  */
 
 
 void dscPrintPanelMessage() {
-  switch (dscPanelData[0]) {
-    case 0x05: dscPrintPanel_0x05(); return;  // Panel status: partitions 1-4
-    case 0x0A: dscPrintPanel_0x0A(); return;  // Panel status in alarm/programming, partitions 1-4
-    case 0x11: dscPrintPanel_0x11(); return;  // Keypad slot query
-    case 0x16: dscPrintPanel_0x16(); return;  // Zone wiring
-    case 0x1B: dscPrintPanel_0x1B(); return;  // Panel status: partitions 5-8
-    case 0x1C: dscPrintPanel_0x1C(); return;  // Verify keypad Fire/Auxiliary/Panic
-    case 0x27: dscPrintPanel_0x27(); return;  // Panel status and zones 1-8 status
-    case 0x28: dscPrintPanel_0x28(); return;  // Zone expander query
-    case 0x2D: dscPrintPanel_0x2D(); return;  // Panel status and zones 9-16 status
-    case 0x34: dscPrintPanel_0x34(); return;  // Panel status and zones 17-24 status
-    case 0x3E: dscPrintPanel_0x3E(); return;  // Panel status and zones 25-32 status
-    case 0x4C: dscPrintPanel_0x4C(); return;  // Unknown Keybus query
-    case 0x58: dscPrintPanel_0x58(); return;  // Unknown Keybus query
-    case 0x5D: dscPrintPanel_0x5D(); return;  // Flash panel lights: status and zones 1-32, partition 1
-    case 0x63: dscPrintPanel_0x63(); return;  // Flash panel lights: status and zones 1-32, partition 2
-    case 0x64: dscPrintPanel_0x64(); return;  // Beep - one-time, partition 1
-    case 0x69: dscPrintPanel_0x69(); return;  // Beep - one-time, partition 2
-    case 0x75: dscPrintPanel_0x75(); return;  // Beep pattern - repeated, partition 1
-    case 0x7A: dscPrintPanel_0x7A(); return;  // Beep pattern - repeated, partition 2
-    case 0x7F: dscPrintPanel_0x7F(); return;  // Beep - one-time long beep, partition 1
-    case 0x82: dscPrintPanel_0x82(); return;  // Beep - one-time long beep, partition 1
-    case 0x87: dscPrintPanel_0x87(); return;  // Panel outputs
-    case 0x8D: dscPrintPanel_0x8D(); return;  // User code programming key response, codes 17-32
-    case 0x94: dscPrintPanel_0x94(); return;  // Unknown - immediate after entering *5 programming
-    case 0xA5: dscPrintPanel_0xA5(); return;  // Date, time, system status messages - partitions 1-2
-    case 0xB1: dscPrintPanel_0xB1(); return;  // Enabled zones 1-32
-    case 0xBB: dscPrintPanel_0xBB(); return;  // Bell
-    case 0xC3: dscPrintPanel_0xC3(); return;  // Keypad status
-    case 0xCE: dscPrintPanel_0xCE(); return;  // Unknown command
-    case 0xD5: dscPrintPanel_0xD5(); return;  // Keypad zone query
-    case 0xE6: dscPrintPanel_0xE6(); return;  // Extended status commands: partitions 3-8, zones 33-64
-    case 0xEB: dscPrintPanel_0xEB(); return;  // Date, time, system status messages - partitions 1-8
-    default: {
-      printf("Unrecognized data");
-      if (!dscValidCRC()) {
-        printf("[No CRC or CRC Error]");
-        return;
-      }
-      else printf("[CRC OK]");
+  const dscCommand *command = dscPanelCommand();
+
+  if (command->print == NULL) {
+    dscPrintf("Unrecognized data");
+    if (!dscValidCRC()) {
+      dscPrintf("[No CRC or CRC Error]");
       return;
     }
+    else dscPrintf("[CRC OK]");
+    return;
   }
+
+  if ((command->options & dscCmdCRC) && !dscValidCRC()) {
+    dscPrintf("[CRC Error]");
+    return;
+  }
+
+  command->print();
 }
 
 
@@ -79,7 +183,7 @@ void dscPrintModuleMessage() {
   }
 
   // Keypad and module responses to panel queries
-  switch (dscCurrentCmd) {
+  switch (dscModuleCmd) {
     case 0x11: dscPrintModule_Panel_0x11(); return;  // Keypad slot query response
     case 0xD5: dscPrintModule_Panel_0xD5(); return;  // Keypad zone query response
   }
@@ -102,167 +206,178 @@ void dscPrintModuleMessage() {
 
  // Keypad lights for commands 0x05, 0x0A, 0x1B, 0x27, 0x2D, 0x34, 0x3E, 0x5D
  void dscPrintPanelLights(byte dscPanelByte) {
-  if (dscPanelData[dscPanelByte] == 0) printf("none ");
+  if (dscPanelData[dscPanelByte] == 0) dscPrintf("none ");
   else {
-    if (bitRead(dscPanelData[dscPanelByte],0)) printf("Ready ");
-    if (bitRead(dscPanelData[dscPanelByte],1)) printf("Armed ");
-    if (bitRead(dscPanelData[dscPanelByte],2)) printf("Memory ");
-    if (bitRead(dscPanelData[dscPanelByte],3)) printf("Bypass ");
-    if (bitRead(dscPanelData[dscPanelByte],4)) printf("Trouble ");
-    if (bitRead(dscPanelData[dscPanelByte],5)) printf("Program ");
-    if (bitRead(dscPanelData[dscPanelByte],6)) printf("Fire ");
-    if (bitRead(dscPanelData[dscPanelByte],7)) printf("Backlight ");
+    if (bitRead(dscPanelData[dscPanelByte],0)) dscPrintf("Ready ");
+    if (bitRead(dscPanelData[dscPanelByte],1)) dscPrintf("Armed ");
+    if (bitRead(dscPanelData[dscPanelByte],2)) dscPrintf("Memory ");
+    if (bitRead(dscPanelData[dscPanelByte],3)) dscPrintf("Bypass ");
+    if (bitRead(dscPanelData[dscPanelByte],4)) dscPrintf("Trouble ");
+    if (bitRead(dscPanelData[dscPanelByte],5)) dscPrintf("Program ");
+    if (bitRead(dscPanelData[dscPanelByte],6)) dscPrintf("Fire ");
+    if (bitRead(dscPanelData[dscPanelByte],7)) dscPrintf("Backlight ");
   }
  }
 
 
 // Messages for commands 0x05, 0x0A, 0x1B, 0x27, 0x2D, 0x34, 0x3E
+#define dscPanelMessageList(X, p) \
+  X(p, 0x01, "Partition ready")                             \
+  X(p, 0x02, "Stay/away zones open")                        \
+  X(p, 0x03, "Zones open")                                  \
+  X(p, 0x04, "Armed stay")                                  \
+  X(p, 0x05, "Armed away")                                  \
+  X(p, 0x07, "Failed to arm")                               \
+  X(p, 0x08, "Exit delay in progress")                      \
+  X(p, 0x09, "Arming with no entry delay")                  \
+  X(p, 0x0B, "Quick exit in progress")                      \
+  X(p, 0x0C, "Entry delay in progress")                     \
+  X(p, 0x0D, "Opening after alarm")                         \
+  X(p, 0x10, "Keypad lockout")                              \
+  X(p, 0x11, "Partition in alarm")                          \
+  X(p, 0x14, "Auto-arm in progress")                        \
+  X(p, 0x15, "Arming with bypassed zones")                  \
+  X(p, 0x16, "Armed with no entry delay")                   \
+  X(p, 0x22, "Recent closing")                              \
+  X(p, 0x33, "Command output in progress")                  \
+  X(p, 0x3D, "Disarmed after alarm in memory")              \
+  X(p, 0x3E, "Partition disarmed")                          \
+  X(p, 0x40, "Keypad blanked")                              \
+  X(p, 0x8A, "Activate stay/away zones")                    \
+  X(p, 0x8B, "Quick exit")                                  \
+  X(p, 0x8E, "Invalid option")                              \
+  X(p, 0x8F, "Invalid access code")                         \
+  X(p, 0x9E, "Enter * function code")                       \
+  X(p, 0x9F, "Enter access code")                           \
+  X(p, 0xA0, "*1: Zone bypass programming")                 \
+  X(p, 0xA1, "*2: Trouble menu")                            \
+  X(p, 0xA2, "*3: Alarm memory display")                    \
+  X(p, 0xA3, "Door chime enabled")                          \
+  X(p, 0xA4, "Door chime disabled")                         \
+  X(p, 0xA5, "Enter master code")                           \
+  X(p, 0xA6, "*5: Access codes")                            \
+  X(p, 0xA7, "*5: Enter new code")                          \
+  X(p, 0xA9, "*6: User functions")                          \
+  X(p, 0xAA, "*6: Time and Date")                           \
+  X(p, 0xAB, "*6: Auto-arm time")                           \
+  X(p, 0xAC, "*6: Auto-arm enabled")                        \
+  X(p, 0xAD, "*6: Auto-arm disabled")                       \
+  X(p, 0xAF, "*6: System test")                             \
+  X(p, 0xB0, "*6: Enable DLS")                              \
+  X(p, 0xB2, "*7: Command output")                          \
+  X(p, 0xB7, "Enter installer code")                        \
+  X(p, 0xB8, "*  pressed while armed")                      \
+  X(p, 0xB9, "*2: Zone tamper menu")                        \
+  X(p, 0xBA, "*2: Zones with low batteries")                \
+  X(p, 0xC6, "*2: Zone fault menu")                         \
+  X(p, 0xC8, "*2: Service required menu")                   \
+  X(p, 0xD0, "*2: Handheld keypads with low batteries")     \
+  X(p, 0xD1, "*2: Wireless keys with low batteries")        \
+  X(p, 0xE4, "*8: Main menu")                               \
+  X(p, 0xE5, "Keypad slot assignment")                      \
+  X(p, 0xE6, "*8: Input required: 2 digits")                \
+  X(p, 0xE7, "*8: Input required: 3 digits")                \
+  X(p, 0xE8, "*8: Input required: 4 digits")                \
+  X(p, 0xEA, "*8: Reporting code: 2 digits")                \
+  X(p, 0xEB, "*8: Telephone number account code: 4 digits") \
+  X(p, 0xEC, "*8: Input required: 6 digits")                \
+  X(p, 0xED, "*8: Input required: 32 digits")               \
+  X(p, 0xEE, "*8: Input required: 1 option per zone")       \
+  X(p, 0xF0, "Function key 1 programming")                  \
+  X(p, 0xF1, "Function key 2 programming")                  \
+  X(p, 0xF2, "Function key 3 programming")                  \
+  X(p, 0xF3, "Function key 4 programming")                  \
+  X(p, 0xF4, "Function key 5 programming")                  \
+  X(p, 0xF8, "Keypad programming")                         
+dscStringTable(dscPanelMessage, dscPanelMessageList)
+
+
 void dscPrintPanelMessages(byte dscPanelByte) {
-  switch (dscPanelData[dscPanelByte]) {
-    case 0x01: printf("Partition ready"); break;
-    case 0x02: printf("Stay/away zones open"); break;
-    case 0x03: printf("Zones open"); break;
-    case 0x04: printf("Armed stay"); break;
-    case 0x05: printf("Armed away"); break;
-    case 0x07: printf("Failed to arm"); break;
-    case 0x08: printf("Exit delay in progress"); break;
-    case 0x09: printf("Arming with no entry delay"); break;
-    case 0x0B: printf("Quick exit in progress"); break;
-    case 0x0C: printf("Entry delay in progress"); break;
-    case 0x0D: printf("Opening after alarm"); break;
-    case 0x10: printf("Keypad lockout"); break;
-    case 0x11: printf("Partition in alarm"); break;
-    case 0x14: printf("Auto-arm in progress"); break;
-    case 0x15: printf("Arming with bypassed zones"); break;
-    case 0x16: printf("Armed with no entry delay"); break;
-    case 0x22: printf("Recent closing"); break;
-    case 0x33: printf("Command output in progress"); break;
-    case 0x3D: printf("Disarmed after alarm in memory"); break;
-    case 0x3E: printf("Partition disarmed"); break;
-    case 0x40: printf("Keypad blanked"); break;
-    case 0x8A: printf("Activate stay/away zones"); break;
-    case 0x8B: printf("Quick exit"); break;
-    case 0x8E: printf("Invalid option"); break;
-    case 0x8F: printf("Invalid access code"); break;
-    case 0x9E: printf("Enter * function code"); break;
-    case 0x9F: printf("Enter access code"); break;
-    case 0xA0: printf("*1: Zone bypass programming"); break;
-    case 0xA1: printf("*2: Trouble menu"); break;
-    case 0xA2: printf("*3: Alarm memory display"); break;
-    case 0xA3: printf("Door chime enabled"); break;
-    case 0xA4: printf("Door chime disabled"); break;
-    case 0xA5: printf("Enter master code"); break;
-    case 0xA6: printf("*5: Access codes"); break;
-    case 0xA7: printf("*5: Enter new code"); break;
-    case 0xA9: printf("*6: User functions"); break;
-    case 0xAA: printf("*6: Time and Date"); break;
-    case 0xAB: printf("*6: Auto-arm time"); break;
-    case 0xAC: printf("*6: Auto-arm enabled"); break;
-    case 0xAD: printf("*6: Auto-arm disabled"); break;
-    case 0xAF: printf("*6: System test"); break;
-    case 0xB0: printf("*6: Enable DLS"); break;
-    case 0xB2: printf("*7: Command output"); break;
-    case 0xB7: printf("Enter installer code"); break;
-    case 0xB8: printf("*  pressed while armed"); break;
-    case 0xB9: printf("*2: Zone tamper menu"); break;
-    case 0xBA: printf("*2: Zones with low batteries"); break;
-    case 0xC6: printf("*2: Zone fault menu"); break;
-    case 0xC8: printf("*2: Service required menu"); break;
-    case 0xD0: printf("*2: Handheld keypads with low batteries"); break;
-    case 0xD1: printf("*2: Wireless keys with low batteries"); break;
-    case 0xE4: printf("*8: Main menu"); break;
-    case 0xE5: printf("Keypad slot assignment"); break;
-    case 0xE6: printf("*8: Input required: 2 digits"); break;
-    case 0xE7: printf("*8: Input required: 3 digits"); break;
-    case 0xE8: printf("*8: Input required: 4 digits"); break;
-    case 0xEA: printf("*8: Reporting code: 2 digits"); break;
-    case 0xEB: printf("*8: Telephone number account code: 4 digits"); break;
-    case 0xEC: printf("*8: Input required: 6 digits"); break;
-    case 0xED: printf("*8: Input required: 32 digits"); break;
-    case 0xEE: printf("*8: Input required: 1 option per zone"); break;
-    case 0xF0: printf("Function key 1 programming"); break;
-    case 0xF1: printf("Function key 2 programming"); break;
-    case 0xF2: printf("Function key 3 programming"); break;
-    case 0xF3: printf("Function key 4 programming"); break;
-    case 0xF4: printf("Function key 5 programming"); break;
-    case 0xF8: printf("Keypad programming"); break;
-    default:
-      printf("Unrecognized data: 0x%02X", dscPanelData[dscPanelByte]);
-      break;
-  }
+  const char *message = dscStringLookup(dscPanelMessage, dscPanelData[dscPanelByte]);
+  if (message != NULL) dscPrintText(message);
+  else dscPrintf("Unrecognized data: 0x%02X", dscPanelData[dscPanelByte]);
+}
+
+
+const char *dscPanelMessageText(byte message) {
+  return dscStringLookup(dscPanelMessage, message);
 }
 
 
 // Status messages for commands 0xA5, 0xEB
+/*
+ *             YYY1YYY2   MMMMDD DDDHHHHH MMMMMM
+ *  10100101 0 00011000 01001111 10110000 11101100 01001001 11111111 11110000 [0xA5] 03/29/2018 16:59 | Duress alarm
+ *  10100101 0 00011000 01001111 11001110 10111100 01001010 11111111 11011111 [0xA5] 03/30/2018 14:47 | Disarmed after alarm in memory
+ *  10100101 0 00011000 01001111 11001010 01000100 01001011 11111111 01100100 [0xA5] 03/30/2018 10:17 | Partition in alarm
+ *  10100101 0 00011000 01010000 01001001 10111000 01001100 11111111 01011001 [0xA5] 04/02/2018 09:46 | Zone expander supervisory alarm
+ *  10100101 0 00011000 01010000 01001010 00000000 01001101 11111111 10100011 [0xA5] 04/02/2018 10:00 | Zone expander supervisory restored
+ *  10100101 0 00011000 01001111 01110010 10011100 01001110 11111111 01100111 [0xA5] 03/27/2018 18:39 | Keypad Fire alarm
+ *  10100101 0 00011000 01001111 01110010 10010000 01001111 11111111 01011100 [0xA5] 03/27/2018 18:36 | Keypad Aux alarm
+ *  10100101 0 00011000 01001111 01110010 10001000 01010000 11111111 01010101 [0xA5] 03/27/2018 18:34 | Keypad Panic alarm
+ *  10100101 0 00010001 01101101 01100000 00000100 01010001 11111111 11010111 [0xA5] 11/11/2011 00:01 | Keypad status check?   // Power-on +124s, keypad sends status update immediately after this
+ *  10100101 0 00011000 01001111 01110010 10011100 01010010 11111111 01101011 [0xA5] 03/27/2018 18:39 | Keypad Fire alarm restored
+ *  10100101 0 00011000 01001111 01110010 10010000 01010011 11111111 01100000 [0xA5] 03/27/2018 18:36 | Keypad Aux alarm restored
+ *  10100101 0 00011000 01001111 01110010 10001000 01010100 11111111 01011001 [0xA5] 03/27/2018 18:34 | Keypad Panic alarm restored
+ *  10100101 0 00011000 01001111 11110110 00110100 10011000 11111111 11001101 [0xA5] 03/31/2018 22:13 | Keypad lockout
+ *  10100101 0 00011000 01001111 11101011 10100100 10111110 11111111 01011000 [0xA5] 03/31/2018 11:41 | Armed partial: Zones bypassed
+ *  10100101 0 00011000 01001111 11101011 00011000 10111111 11111111 11001101 [0xA5] 03/31/2018 11:06 | Armed special: quick-arm/auto-arm/keyswitch/wireless key/DLS
+ *  10100101 0 00010001 01101101 01100000 00101000 11100101 11111111 10001111 [0xA5] 11/11/2011 00:10 | Auto-arm cancelled
+ *  10100101 0 00011000 01001111 11110111 01000000 11100110 11111111 00101000 [0xA5] 03/31/2018 23:16 | Disarmed special: keyswitch/wireless key/DLS
+ *  10100101 0 00011000 01001111 01101111 01011100 11100111 11111111 10111101 [0xA5] 03/27/2018 15:23 | Panel battery trouble
+ *  10100101 0 00011000 01001111 10110011 10011000 11101000 11111111 00111110 [0xA5] 03/29/2018 19:38 | AC power failure  // Sent after delay in *8 [370]
+ *  10100101 0 00011000 01001111 01110100 01010000 11101001 11111111 10111000 [0xA5] 03/27/2018 20:20 | Bell trouble
+ *  10100101 0 00011000 01001111 11000000 10001000 11101100 11111111 00111111 [0xA5] 03/30/2018 00:34 | Telephone line trouble
+ *  10100101 0 00011000 01001111 01101111 01110000 11101111 11111111 11011001 [0xA5] 03/27/2018 15:28 | Panel battery restored
+ *  10100101 0 00011000 01010000 00100000 01011000 11110000 11111111 01110100 [0xA5] 04/01/2018 00:22 | AC power restored  // Sent after delay in *8 [370]
+ *  10100101 0 00011000 01001111 01110100 01011000 11110001 11111111 11001000 [0xA5] 03/27/2018 20:22 | Bell restored
+ *  10100101 0 00011000 01001111 11000000 10001000 11110100 11111111 01000111 [0xA5] 03/30/2018 00:34 | Telephone line restored
+ *  10100101 0 00011000 01001111 11100001 01011000 11111111 11111111 01000011 [0xA5] 03/31/2018 01:22 | System test
+ */
+#define dscPanelStatus0List(X, p) \
+  /* 0x09 - 0x28: Zone alarm, zones 1-32 */                                  \
+  /* 0x29 - 0x48: Zone alarm restored, zones 1-32 */                         \
+  X(p, 0x49, "Duress alarm")                                                 \
+  X(p, 0x4A, "Disarmed after alarm in memory")                               \
+  X(p, 0x4B, "Partition in alarm")                                           \
+  X(p, 0x4C, "Zone expander supervisory alarm")                              \
+  X(p, 0x4D, "Zone expander supervisory restored")                           \
+  X(p, 0x4E, "Keypad Fire alarm")                                            \
+  X(p, 0x4F, "Keypad Aux alarm")                                             \
+  X(p, 0x50, "Keypad Panic alarm")                                           \
+  X(p, 0x51, "Auxiliary input alarm")                                        \
+  X(p, 0x52, "Keypad Fire alarm restored")                                   \
+  X(p, 0x53, "Keypad Aux alarm restored")                                    \
+  X(p, 0x54, "Keypad Panic alarm restored")                                  \
+  X(p, 0x55, "Auxilary input alarm restored")                                \
+  /* 0x56 - 0x75: Zone tamper, zones 1-32 */                                 \
+  /* 0x76 - 0x95: Zone tamper restored, zones 1-32 */                        \
+  X(p, 0x98, "Keypad lockout")                                               \
+  /* 0x99 - 0xBD: Armed by access code */                                    \
+  X(p, 0xBE, "Armed partial: Zones bypassed")                                \
+  X(p, 0xBF, "Armed special: quick-arm/auto-arm/keyswitch/wireless key/DLS") \
+  /* 0xC0 - 0xE4: Disarmed by access code */                                 \
+  X(p, 0xE5, "Auto-arm cancelled")                                           \
+  X(p, 0xE6, "Disarmed special: keyswitch/wireless key/DLS")                 \
+  X(p, 0xE7, "Panel battery trouble")                                        \
+  X(p, 0xE8, "Panel AC power failure")                                       \
+  X(p, 0xE9, "Bell trouble")                                                 \
+  X(p, 0xEA, "Power on +16s")                                                \
+  X(p, 0xEC, "Telephone line trouble")                                       \
+  X(p, 0xEF, "Panel battery restored")                                       \
+  X(p, 0xF0, "Panel AC power restored")                                      \
+  X(p, 0xF1, "Bell restored")                                                \
+  X(p, 0xF4, "Telephone line restored")                                      \
+  X(p, 0xFF, "System test")                                                 
+dscStringTable(dscPanelStatus0, dscPanelStatus0List)
+
+
 void dscPrintPanelStatus0(byte dscPanelByte) {
-  bool decoded = true;
-  switch (dscPanelData[dscPanelByte]) {
-    /*
-     *             YYY1YYY2   MMMMDD DDDHHHHH MMMMMM
-     *  10100101 0 00011000 01001111 10110000 11101100 01001001 11111111 11110000 [0xA5] 03/29/2018 16:59 | Duress alarm
-     *  10100101 0 00011000 01001111 11001110 10111100 01001010 11111111 11011111 [0xA5] 03/30/2018 14:47 | Disarmed after alarm in memory
-     *  10100101 0 00011000 01001111 11001010 01000100 01001011 11111111 01100100 [0xA5] 03/30/2018 10:17 | Partition in alarm
-     *  10100101 0 00011000 01010000 01001001 10111000 01001100 11111111 01011001 [0xA5] 04/02/2018 09:46 | Zone expander supervisory alarm
-     *  10100101 0 00011000 01010000 01001010 00000000 01001101 11111111 10100011 [0xA5] 04/02/2018 10:00 | Zone expander supervisory restored
-     *  10100101 0 00011000 01001111 01110010 10011100 01001110 11111111 01100111 [0xA5] 03/27/2018 18:39 | Keypad Fire alarm
-     *  10100101 0 00011000 01001111 01110010 10010000 01001111 11111111 01011100 [0xA5] 03/27/2018 18:36 | Keypad Aux alarm
-     *  10100101 0 00011000 01001111 01110010 10001000 01010000 11111111 01010101 [0xA5] 03/27/2018 18:34 | Keypad Panic alarm
-     *  10100101 0 00010001 01101101 01100000 00000100 01010001 11111111 11010111 [0xA5] 11/11/2011 00:01 | Keypad status check?   // Power-on +124s, keypad sends status update immediately after this
-     *  10100101 0 00011000 01001111 01110010 10011100 01010010 11111111 01101011 [0xA5] 03/27/2018 18:39 | Keypad Fire alarm restored
-     *  10100101 0 00011000 01001111 01110010 10010000 01010011 11111111 01100000 [0xA5] 03/27/2018 18:36 | Keypad Aux alarm restored
-     *  10100101 0 00011000 01001111 01110010 10001000 01010100 11111111 01011001 [0xA5] 03/27/2018 18:34 | Keypad Panic alarm restored
-     *  10100101 0 00011000 01001111 11110110 00110100 10011000 11111111 11001101 [0xA5] 03/31/2018 22:13 | Keypad lockout
-     *  10100101 0 00011000 01001111 11101011 10100100 10111110 11111111 01011000 [0xA5] 03/31/2018 11:41 | Armed partial: Zones bypassed
-     *  10100101 0 00011000 01001111 11101011 00011000 10111111 11111111 11001101 [0xA5] 03/31/2018 11:06 | Armed special: quick-arm/auto-arm/keyswitch/wireless key/DLS
-     *  10100101 0 00010001 01101101 01100000 00101000 11100101 11111111 10001111 [0xA5] 11/11/2011 00:10 | Auto-arm cancelled
-     *  10100101 0 00011000 01001111 11110111 01000000 11100110 11111111 00101000 [0xA5] 03/31/2018 23:16 | Disarmed special: keyswitch/wireless key/DLS
-     *  10100101 0 00011000 01001111 01101111 01011100 11100111 11111111 10111101 [0xA5] 03/27/2018 15:23 | Panel battery trouble
-     *  10100101 0 00011000 01001111 10110011 10011000 11101000 11111111 00111110 [0xA5] 03/29/2018 19:38 | AC power failure  // Sent after delay in *8 [370]
-     *  10100101 0 00011000 01001111 01110100 01010000 11101001 11111111 10111000 [0xA5] 03/27/2018 20:20 | Bell trouble
-     *  10100101 0 00011000 01001111 11000000 10001000 11101100 11111111 00111111 [0xA5] 03/30/2018 00:34 | Telephone line trouble
-     *  10100101 0 00011000 01001111 01101111 01110000 11101111 11111111 11011001 [0xA5] 03/27/2018 15:28 | Panel battery restored
-     *  10100101 0 00011000 01010000 00100000 01011000 11110000 11111111 01110100 [0xA5] 04/01/2018 00:22 | AC power restored  // Sent after delay in *8 [370]
-     *  10100101 0 00011000 01001111 01110100 01011000 11110001 11111111 11001000 [0xA5] 03/27/2018 20:22 | Bell restored
-     *  10100101 0 00011000 01001111 11000000 10001000 11110100 11111111 01000111 [0xA5] 03/30/2018 00:34 | Telephone line restored
-     *  10100101 0 00011000 01001111 11100001 01011000 11111111 11111111 01000011 [0xA5] 03/31/2018 01:22 | System test
-     */
-    // 0x09 - 0x28: Zone alarm, zones 1-32
-    // 0x29 - 0x48: Zone alarm restored, zones 1-32
-    case 0x49: printf("Duress alarm"); break;
-    case 0x4A: printf("Disarmed after alarm in memory"); break;
-    case 0x4B: printf("Partition in alarm"); break;
-    case 0x4C: printf("Zone expander supervisory alarm"); break;
-    case 0x4D: printf("Zone expander supervisory restored"); break;
-    case 0x4E: printf("Keypad Fire alarm"); break;
-    case 0x4F: printf("Keypad Aux alarm"); break;
-    case 0x50: printf("Keypad Panic alarm"); break;
-    case 0x51: printf("Auxiliary input alarm"); break;
-    case 0x52: printf("Keypad Fire alarm restored"); break;
-    case 0x53: printf("Keypad Aux alarm restored"); break;
-    case 0x54: printf("Keypad Panic alarm restored"); break;
-    case 0x55: printf("Auxilary input alarm restored"); break;
-    // 0x56 - 0x75: Zone tamper, zones 1-32
-    // 0x76 - 0x95: Zone tamper restored, zones 1-32
-    case 0x98: printf("Keypad lockout"); break;
-    // 0x99 - 0xBD: Armed by access code
-    case 0xBE: printf("Armed partial: Zones bypassed"); break;
-    case 0xBF: printf("Armed special: quick-arm/auto-arm/keyswitch/wireless key/DLS"); break;
-    // 0xC0 - 0xE4: Disarmed by access code
-    case 0xE5: printf("Auto-arm cancelled"); break;
-    case 0xE6: printf("Disarmed special: keyswitch/wireless key/DLS"); break;
-    case 0xE7: printf("Panel battery trouble"); break;
-    case 0xE8: printf("Panel AC power failure"); break;
-    case 0xE9: printf("Bell trouble"); break;
-    case 0xEA: printf("Power on +16s"); break;
-    case 0xEC: printf("Telephone line trouble"); break;
-    case 0xEF: printf("Panel battery restored"); break;
-    case 0xF0: printf("Panel AC power restored"); break;
-    case 0xF1: printf("Bell restored"); break;
-    case 0xF4: printf("Telephone line restored"); break;
-    case 0xFF: printf("System test"); break;
-    default: decoded = false;
-  }
-  if (decoded) return;
+  const char *message = dscStringLookup(dscPanelStatus0, dscPanelData[dscPanelByte]);
+  if (message != NULL) {
+    dscPrintText(message);
+    return;
+  }
 
   /*
    *  Zone alarm, zones 1-32
@@ -273,7 +388,7 @@ void dscPrintPanelStatus0(byte dscPanelByte) {
    *  10100101 0 00011000 01001111 10010100 11001000 00010000 11111111 01110111 [0xA5] 03/28/2018 20:50 | Zone alarm: 8
    */
   if (dscPanelData[dscPanelByte] >= 0x09 && dscPanelData[dscPanelByte] <= 0x28) {
-    printf("Zone alarm: %d", dscPanelData[dscPanelByte] - 0x08);
+    dscPrintf("Zone alarm: %d", dscPanelData[dscPanelByte] - 0x08);
     return;
   }
 
@@ -286,7 +401,7 @@ void dscPrintPanelStatus0(byte dscPanelByte) {
    *  10100101 0 00011000 01001111 10010100 11010000 00110000 11111111 10011111 [0xA5] 03/28/2018 20:52 | Zone alarm restored: 8
    */
   if (dscPanelData[dscPanelByte] >= 0x29 && dscPanelData[dscPanelByte] <= 0x48) {
-    printf("Zone alarm restored: %d", dscPanelData[dscPanelByte] - 0x28);
+    dscPrintf("Zone alarm restored: %d", dscPanelData[dscPanelByte] - 0x28);
     return;
   }
 
@@ -299,7 +414,7 @@ void dscPrintPanelStatus0(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01101011 10010000 01011011 11111111 01111000 [0xA5] 11/11/2011 11:36 | Zone tamper: 6
    */
   if (dscPanelData[dscPanelByte] >= 0x56 && dscPanelData[dscPanelByte] <= 0x75) {
-    printf("Zone tamper: %d", dscPanelData[6] - 0x55);
+    dscPrintf("Zone tamper: %d", dscPanelData[6] - 0x55);
     return;
   }
 
@@ -312,7 +427,7 @@ void dscPrintPanelStatus0(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01101011 10010000 01111011 11111111 10011000 [0xA5] 11/11/2011 11:36 | Zone tamper restored: 6
    */
   if (dscPanelData[dscPanelByte] >= 0x76 && dscPanelData[dscPanelByte] <= 0x95) {
-    printf("Zone tamper restored: %d", dscPanelData[dscPanelByte] - 0x75);
+    dscPrintf("Zone tamper restored: %d", dscPanelData[dscPanelByte] - 0x75);
     return;
   }
 
@@ -326,16 +441,16 @@ void dscPrintPanelStatus0(byte dscPanelByte) {
   if (dscPanelData[dscPanelByte] >= 0x99 && dscPanelData[dscPanelByte] <= 0xBD) {
     byte dscCode = dscPanelData[dscPanelByte] - 0x98;
     if (dscCode >= 35) dscCode += 5;
-    printf("Armed by ");
+    dscPrintf("Armed by ");
     switch (dscCode) {
-      case 33: printf("duress "); break;
-      case 34: printf("duress "); break;
-      case 40: printf("master "); break;
-      case 41: printf("supervisor "); break;
-      case 42: printf("supervisor "); break;
-      default: printf("user "); break;
+      case 33: dscPrintf("duress "); break;
+      case 34: dscPrintf("duress "); break;
+      case 40: dscPrintf("master "); break;
+      case 41: dscPrintf("supervisor "); break;
+      case 42: dscPrintf("supervisor "); break;
+      default: dscPrintf("user "); break;
     }
-    printf("code %d", dscCode);
+    dscPrintf("code %d", dscCode);
     return;
   }
 
@@ -349,56 +464,63 @@ void dscPrintPanelStatus0(byte dscPanelByte) {
   if (dscPanelData[dscPanelByte] >= 0xC0 && dscPanelData[dscPanelByte] <= 0xE4) {
     byte dscCode = dscPanelData[dscPanelByte] - 0xBF;
     if (dscCode >= 35) dscCode += 5;
-    printf("Disarmed by ");
+    dscPrintf("Disarmed by ");
     switch (dscCode) {
-      case 33: printf("duress "); break;
-      case 34: printf("duress "); break;
-      case 40: printf("master "); break;
-      case 41: printf("supervisor "); break;
-      case 42: printf("supervisor "); break;
-      default: printf("user "); break;
+      case 33: dscPrintf("duress "); break;
+      case 34: dscPrintf("duress "); break;
+      case 40: dscPrintf("master "); break;
+      case 41: dscPrintf("supervisor "); break;
+      case 42: dscPrintf("supervisor "); break;
+      default: dscPrintf("user "); break;
     }
-    printf("code %d", dscCode);
+    dscPrintf("code %d", dscCode);
     return;
   }
 
-  printf("Unrecognized data");
+  dscPrintf("Unrecognized data");
 }
 
 
 // Status messages for commands 0xA5, 0xEB
+/*
+ *             YYY1YYY2   MMMMDD DDDHHHHH MMMMMM
+ *  10100101 0 00011000 01001111 11001010 10001001 00000011 11111111 01100001 [0xA5] 03/30/2018 10:34 | Cross zone alarm
+ *  10100101 0 00010001 01101101 01101010 00000001 00000100 11111111 10010001 [0xA5] 11/11/2011 10:00 | Delinquency alarm
+ *  10100101 0 00010001 01101101 01100000 10101001 00100100 00000000 01010000 [0xA5] 11/11/2011 00:42 | Auto-arm cancelled by duress code 33
+ *  10100101 0 00010001 01101101 01100000 10110101 00100101 00000000 01011101 [0xA5] 11/11/2011 00:45 | Auto-arm cancelled by duress code 34
+ *  10100101 0 00010001 01101101 01100000 00101001 00100110 00000000 11010010 [0xA5] 11/11/2011 00:10 | Auto-arm cancelled by master code 40
+ *  10100101 0 00010001 01101101 01100000 10010001 00100111 00000000 00111011 [0xA5] 11/11/2011 00:36 | Auto-arm cancelled by supervisor code 41
+ *  10100101 0 00010001 01101101 01100000 10111001 00101000 00000000 01100100 [0xA5] 11/11/2011 00:46 | Auto-arm cancelled by supervisor code 42
+ *  10100101 0 00011000 01001111 10100000 10011101 00101011 00000000 01110100 [0xA5] 03/29/2018 00:39 | Armed by auto-arm
+ *  10100101 0 00011000 01001101 00001010 00001101 10101100 00000000 11001101 [0xA5] 03/08/2018 10:03 | Exit *8 programming
+ *  10100101 0 00011000 01001101 00001001 11100001 10101101 00000000 10100001 [0xA5] 03/08/2018 09:56 | Enter *8
+ *  10100101 0 00010001 01101101 01100010 11001101 11010000 00000000 00100010 [0xA5] 11/11/2011 02:51 | Command output 4
+ *  10100101 0 00010110 01010110 00101011 11010001 11010010 00000000 11011111 [0xA5] 2016.05.17 11:52 | Armed with no entry delay cancelled
+ */
+#define dscPanelStatus1List(X, p) \
+  X(p, 0x03, "Cross zone alarm")                         \
+  X(p, 0x04, "Delinquency alarm")                        \
+  X(p, 0x24, "Auto-arm cancelled by duress code 33")     \
+  X(p, 0x25, "Auto-arm cancelled by duress code 34")     \
+  X(p, 0x26, "Auto-arm cancelled by master code 40")     \
+  X(p, 0x27, "Auto-arm cancelled by supervisor code 41") \
+  X(p, 0x28, "Auto-arm cancelled by supervisor code 42") \
+  X(p, 0x2B, "Armed by auto-arm")                        \
+  /* 0x6C - 0x8B: Zone fault restored, zones 1-32 */     \
+  /* 0x8C - 0xAB: Zone fault, zones 1-32 */              \
+  X(p, 0xAC, "Exit *8 programming")                      \
+  X(p, 0xAD, "Enter *8 programming")                     \
+  /* 0xB0 - 0xCF: Zones bypassed, zones 1-32 */          \
+  X(p, 0xD0, "Command output 4")                         \
+  X(p, 0xD2, "Armed with no entry delay cancelled")     
+dscStringTable(dscPanelStatus1, dscPanelStatus1List)
+
+
 void dscPrintPanelStatus1(byte dscPanelByte) {
-  switch (dscPanelData[dscPanelByte]) {
-    /*
-     *             YYY1YYY2   MMMMDD DDDHHHHH MMMMMM
-     *  10100101 0 00011000 01001111 11001010 10001001 00000011 11111111 01100001 [0xA5] 03/30/2018 10:34 | Cross zone alarm
-     *  10100101 0 00010001 01101101 01101010 00000001 00000100 11111111 10010001 [0xA5] 11/11/2011 10:00 | Delinquency alarm
-     *  10100101 0 00010001 01101101 01100000 10101001 00100100 00000000 01010000 [0xA5] 11/11/2011 00:42 | Auto-arm cancelled by duress code 33
-     *  10100101 0 00010001 01101101 01100000 10110101 00100101 00000000 01011101 [0xA5] 11/11/2011 00:45 | Auto-arm cancelled by duress code 34
-     *  10100101 0 00010001 01101101 01100000 00101001 00100110 00000000 11010010 [0xA5] 11/11/2011 00:10 | Auto-arm cancelled by master code 40
-     *  10100101 0 00010001 01101101 01100000 10010001 00100111 00000000 00111011 [0xA5] 11/11/2011 00:36 | Auto-arm cancelled by supervisor code 41
-     *  10100101 0 00010001 01101101 01100000 10111001 00101000 00000000 01100100 [0xA5] 11/11/2011 00:46 | Auto-arm cancelled by supervisor code 42
-     *  10100101 0 00011000 01001111 10100000 10011101 00101011 00000000 01110100 [0xA5] 03/29/2018 00:39 | Armed by auto-arm
-     *  10100101 0 00011000 01001101 00001010 00001101 10101100 00000000 11001101 [0xA5] 03/08/2018 10:03 | Exit *8 programming
-     *  10100101 0 00011000 01001101 00001001 11100001 10101101 00000000 10100001 [0xA5] 03/08/2018 09:56 | Enter *8
-     *  10100101 0 00010001 01101101 01100010 11001101 11010000 00000000 00100010 [0xA5] 11/11/2011 02:51 | Command output 4
-     *  10100101 0 00010110 01010110 00101011 11010001 11010010 00000000 11011111 [0xA5] 2016.05.17 11:52 | Armed with no entry delay cancelled
-     */
-    case 0x03: printf("Cross zone alarm"); return;
-    case 0x04: printf("Delinquency alarm"); return;
-    case 0x24: printf("Auto-arm cancelled by duress code 33"); return;
-    case 0x25: printf("Auto-arm cancelled by duress code 34"); return;
-    case 0x26: printf("Auto-arm cancelled by master code 40"); return;
-    case 0x27: printf("Auto-arm cancelled by supervisor code 41"); return;
-    case 0x28: printf("Auto-arm cancelled by supervisor code 42"); return;
-    case 0x2B: printf("Armed by auto-arm"); return;
-    // 0x6C - 0x8B: Zone fault restored, zones 1-32
-    // 0x8C - 0xAB: Zone fault, zones 1-32
-    case 0xAC: printf("Exit *8 programming"); return;
-    case 0xAD: printf("Enter *8 programming"); return;
-    // 0xB0 - 0xCF: Zones bypassed, zones 1-32
-    case 0xD0: printf("Command output 4"); return;
-    case 0xD2: printf("Armed with no entry delay cancelled"); return;
+  const char *message = dscStringLookup(dscPanelStatus1, dscPanelData[dscPanelByte]);
+  if (message != NULL) {
+    dscPrintText(message);
+    return;
   }
 
   /*
@@ -411,7 +533,7 @@ void dscPrintPanelStatus1(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01101011 10001001 01110000 11111111 10000110 [0xA5] 11/11/2011 11:34 | Zone fault restored: 5
    */
   if (dscPanelData[dscPanelByte] >= 0x6C && dscPanelData[dscPanelByte] <= 0x8B) {
-    printf("Zone fault restored: %d", dscPanelData[dscPanelByte] - 0x6B);
+    dscPrintf("Zone fault restored: %d", dscPanelData[dscPanelByte] - 0x6B);
     return;
   }
 
@@ -425,7 +547,7 @@ void dscPrintPanelStatus1(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01101011 10001001 10010000 11111111 10100110 [0xA5] 11/11/2011 11:34 | Zone fault: 4
    */
   if (dscPanelData[dscPanelByte] >= 0x8C && dscPanelData[dscPanelByte] <= 0xAB) {
-    printf("Zone fault: %d", dscPanelData[dscPanelByte] - 0x8B);
+    dscPrintf("Zone fault: %d", dscPanelData[dscPanelByte] - 0x8B);
     return;
   }
 
@@ -437,59 +559,65 @@ void dscPrintPanelStatus1(byte dscPanelByte) {
    *  10100101 0 00011000 01001111 10110001 11000001 10110101 00000000 00110011 [0xA5] 03/29/2018 17:48 | Zone bypassed: 6
    */
   if (dscPanelData[dscPanelByte] >= 0xB0 && dscPanelData[dscPanelByte] <= 0xCF) {
-    printf("Zone bypassed: %d", dscPanelData[dscPanelByte] - 0xAF);
+    dscPrintf("Zone bypassed: %d", dscPanelData[dscPanelByte] - 0xAF);
     return;
   }
 
-  printf("Unrecognized data");
+  dscPrintf("Unrecognized data");
 }
 
 
 // Status messages for commands 0xA5, 0xEB
+/*
+ *             YYY1YYY2   MMMMDD DDDHHHHH MMMMMM
+ *  10100101 0 00011000 01001111 10101111 10000110 00101010 00000000 01101011 [0xA5] 03/29/2018 15:33 | Quick exit
+ *  10100101 0 00010001 01101101 01110101 00111010 01100011 00000000 00110101 [0xA5] 11/11/2011 21:14 | Keybus fault restored
+ *  10100101 0 00011000 01001111 11110111 01110110 01100110 00000000 11011111 [0xA5] 03/31/2018 23:29 | Enter *1 zone bypass programming
+ *  10100101 0 00010001 01101101 01100010 11001110 01101001 00000000 10111100 [0xA5] 11/11/2011 02:51 | Command output 3
+ *  10100101 0 00011000 01010000 01000000 00000010 10001100 00000000 11011011 [0xA5] 04/02/2018 00:00 | Loss of system time
+ *  10100101 0 00011000 01001111 10101110 00001110 10001101 00000000 01010101 [0xA5] 03/29/2018 14:03 | Power on
+ *  10100101 0 00011000 01010000 01000000 00000010 10001110 00000000 11011101 [0xA5] 04/02/2018 00:00 | Panel factory default
+ *  10100101 0 00011000 01001111 11101010 10111010 10010011 00000000 01000011 [0xA5] 03/31/2018 10:46 | Disarmed by keyswitch
+ *  10100101 0 00011000 01001111 11101010 10101110 10010110 00000000 00111010 [0xA5] 03/31/2018 10:43 | Armed by keyswitch
+ *  10100101 0 00011000 01001111 10100000 01100010 10011000 00000000 10100110 [0xA5] 03/29/2018 00:24 | Armed by quick-arm
+ *  10100101 0 00010001 01101101 01100000 00101110 10011001 00000000 01001010 [0xA5] 11/11/2011 00:11 | Activate stay/away zones
+ *  10100101 0 00011000 01001111 00101101 00011010 10011010 00000000 11101101 [0xA5] 03/25/2018 13:06 | Armed: stay
+ *  10100101 0 00011000 01001111 00101101 00010010 10011011 00000000 11100110 [0xA5] 03/25/2018 13:04 | Armed: away
+ *  10100101 0 00011000 01001111 00101101 10011010 10011100 00000000 01101111 [0xA5] 03/25/2018 13:38 | Armed with no entry delay
+ *  10100101 0 00011000 01001111 00101100 11011110 11000011 00000000 11011001 [0xA5] 03/25/2018 12:55 | Enter *5 programming
+ *  10100101 0 00011000 01001111 00101110 00000010 11100110 00000000 00100010 [0xA5] 03/25/2018 14:00 | Enter *6 programming
+ */
+#define dscPanelStatus2List(X, p) \
+  X(p, 0x2A, "Quick exit")                                  \
+  X(p, 0x63, "Keybus fault restored")                       \
+  X(p, 0x66, "Enter *1 zone bypass programming")            \
+  X(p, 0x67, "Command output 1")                            \
+  X(p, 0x68, "Command output 2")                            \
+  X(p, 0x69, "Command output 3")                            \
+  X(p, 0x8C, "Loss of system time")                         \
+  X(p, 0x8D, "Power on")                                    \
+  X(p, 0x8E, "Panel factory default")                       \
+  X(p, 0x93, "Disarmed by keyswitch")                       \
+  X(p, 0x96, "Armed by keyswitch")                          \
+  X(p, 0x97, "Armed by keypad away")                        \
+  X(p, 0x98, "Armed by quick-arm")                          \
+  X(p, 0x99, "Activate stay/away zones")                    \
+  X(p, 0x9A, "Armed: stay")                                 \
+  X(p, 0x9B, "Armed: away")                                 \
+  X(p, 0x9C, "Armed with no entry delay")                   \
+  X(p, 0xC3, "Enter *5 programming")                        \
+  /* 0xC6 - 0xE5: Auto-arm cancelled by user code */        \
+  X(p, 0xE6, "Enter *6 programming")                        \
+  /* 0xE9 - 0xF0: Supervisory restored, keypad slots 1-8 */ \
+  /* 0xF1 - 0xF8: Supervisory trouble, keypad slots 1-8 */ 
+dscStringTable(dscPanelStatus2, dscPanelStatus2List)
+
+
 void dscPrintPanelStatus2(byte dscPanelByte) {
-  switch (dscPanelData[dscPanelByte]) {
-
-    /*
-     *             YYY1YYY2   MMMMDD DDDHHHHH MMMMMM
-     *  10100101 0 00011000 01001111 10101111 10000110 00101010 00000000 01101011 [0xA5] 03/29/2018 15:33 | Quick exit
-     *  10100101 0 00010001 01101101 01110101 00111010 01100011 00000000 00110101 [0xA5] 11/11/2011 21:14 | Keybus fault restored
-     *  10100101 0 00011000 01001111 11110111 01110110 01100110 00000000 11011111 [0xA5] 03/31/2018 23:29 | Enter *1 zone bypass programming
-     *  10100101 0 00010001 01101101 01100010 11001110 01101001 00000000 10111100 [0xA5] 11/11/2011 02:51 | Command output 3
-     *  10100101 0 00011000 01010000 01000000 00000010 10001100 00000000 11011011 [0xA5] 04/02/2018 00:00 | Loss of system time
-     *  10100101 0 00011000 01001111 10101110 00001110 10001101 00000000 01010101 [0xA5] 03/29/2018 14:03 | Power on
-     *  10100101 0 00011000 01010000 01000000 00000010 10001110 00000000 11011101 [0xA5] 04/02/2018 00:00 | Panel factory default
-     *  10100101 0 00011000 01001111 11101010 10111010 10010011 00000000 01000011 [0xA5] 03/31/2018 10:46 | Disarmed by keyswitch
-     *  10100101 0 00011000 01001111 11101010 10101110 10010110 00000000 00111010 [0xA5] 03/31/2018 10:43 | Armed by keyswitch
-     *  10100101 0 00011000 01001111 10100000 01100010 10011000 00000000 10100110 [0xA5] 03/29/2018 00:24 | Armed by quick-arm
-     *  10100101 0 00010001 01101101 01100000 00101110 10011001 00000000 01001010 [0xA5] 11/11/2011 00:11 | Activate stay/away zones
-     *  10100101 0 00011000 01001111 00101101 00011010 10011010 00000000 11101101 [0xA5] 03/25/2018 13:06 | Armed: stay
-     *  10100101 0 00011000 01001111 00101101 00010010 10011011 00000000 11100110 [0xA5] 03/25/2018 13:04 | Armed: away
-     *  10100101 0 00011000 01001111 00101101 10011010 10011100 00000000 01101111 [0xA5] 03/25/2018 13:38 | Armed with no entry delay
-     *  10100101 0 00011000 01001111 00101100 11011110 11000011 00000000 11011001 [0xA5] 03/25/2018 12:55 | Enter *5 programming
-     *  10100101 0 00011000 01001111 00101110 00000010 11100110 00000000 00100010 [0xA5] 03/25/2018 14:00 | Enter *6 programming
-     */
-    case 0x2A: printf("Quick exit"); return;
-    case 0x63: printf("Keybus fault restored"); return;
-    case 0x66: printf("Enter *1 zone bypass programming"); return;
-    case 0x67: printf("Command output 1"); return;
-    case 0x68: printf("Command output 2"); return;
-    case 0x69: printf("Command output 3"); return;
-    case 0x8C: printf("Loss of system time"); return;
-    case 0x8D: printf("Power on"); return;
-    case 0x8E: printf("Panel factory default"); return;
-    case 0x93: printf("Disarmed by keyswitch"); return;
-    case 0x96: printf("Armed by keyswitch"); return;
-    case 0x97: printf("Armed by keypad away"); return;
-    case 0x98: printf("Armed by quick-arm"); return;
-    case 0x99: printf("Activate stay/away zones"); return;
-    case 0x9A: printf("Armed: stay"); return;
-    case 0x9B: printf("Armed: away"); return;
-    case 0x9C: printf("Armed with no entry delay"); return;
-    case 0xC3: printf("Enter *5 programming"); return;
-    // 0xC6 - 0xE5: Auto-arm cancelled by user code
-    case 0xE6: printf("Enter *6 programming"); return;
-    // 0xE9 - 0xF0: Supervisory restored, keypad slots 1-8
-    // 0xF1 - 0xF8: Supervisory trouble, keypad slots 1-8
+  const char *message = dscStringLookup(dscPanelStatus2, dscPanelData[dscPanelByte]);
+  if (message != NULL) {
+    dscPrintText(message);
+    return;
   }
 
   /*
@@ -500,7 +628,7 @@ void dscPrintPanelStatus2(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01100000 01111010 11100101 00000000 11100010 [0xA5] 11/11/2011 00:30 | Auto-arm cancelled by user code 32
    */
   if (dscPanelData[dscPanelByte] >= 0xC6 && dscPanelData[dscPanelByte] <= 0xE5) {
-    printf("Auto-arm cancelled by user code %d", dscPanelData[dscPanelByte] - 0xC5);
+    dscPrintf("Auto-arm cancelled by user code %d", dscPanelData[dscPanelByte] - 0xC5);
     return;
   }
 
@@ -512,7 +640,7 @@ void dscPrintPanelStatus2(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01110100 00110010 11110000 11111111 10111000 [0xA5] 11/11/2011 20:12 | Supervisory - module detected: Keypad slot 8
    */
   if (dscPanelData[dscPanelByte] >= 0xE9 && dscPanelData[dscPanelByte] <= 0xF0) {
-    printf("Supervisory - module detected: Keypad slot %d", dscPanelData[dscPanelByte] - 0xE8);
+    dscPrintf("Supervisory - module detected: Keypad slot %d", dscPanelData[dscPanelByte] - 0xE8);
     return;
   }
 
@@ -524,61 +652,71 @@ void dscPrintPanelStatus2(byte dscPanelByte) {
    *  10100101 0 00010001 01101101 01110100 00101110 11111000 11111111 10111100 [0xA5] 11/11/2011 20:11 | Supervisory - module trouble: Keypad slot 8
    */
   if (dscPanelData[dscPanelByte] >= 0xF1 && dscPanelData[dscPanelByte] <= 0xF8) {
-    printf("Supervisory - module trouble: Keypad slot %d", dscPanelData[dscPanelByte] - 0xF0);
+    dscPrintf("Supervisory - module trouble: Keypad slot %d", dscPanelData[dscPanelByte] - 0xF0);
     return;
   }
 
-  printf("Unrecognized data");
+  dscPrintf("Unrecognized data");
+}
+
+
+const char *dscPanelEventText(byte group, byte code) {
+  switch (group) {
+    case 0x00: return dscStringLookup(dscPanelStatus0, code);
+    case 0x01: return dscStringLookup(dscPanelStatus1, code);
+    case 0x02: return dscStringLookup(dscPanelStatus2, code);
+    default: return NULL;
+  }
 }
 
 
 // Status messages for commands 0xA5, 0xEB
 void dscPrintPanelStatus3(byte dscPanelByte) {
-  printf("Unrecognized data: 0x%02X", dscPanelByte);
+  dscPrintf("Unrecognized data: 0x%02X", dscPanelByte);
 }
 
 
 // Status messages for command 0xEB
 void dscPrintPanelStatus4(byte dscPanelByte) {
   if (dscPanelData[dscPanelByte] <= 0x1F) {
-    printf("Zone alarm: %d", dscPanelData[dscPanelByte] + 33);
+    dscPrintf("Zone alarm: %d", dscPanelData[dscPanelByte] + 33);
     return;
   }
 
   if (dscPanelData[dscPanelByte] >= 0x20 && dscPanelData[dscPanelByte] <= 0x3F) {
-    printf("Zone alarm restored: %d", dscPanelData[dscPanelByte] + 1);
+    dscPrintf("Zone alarm restored: %d", dscPanelData[dscPanelByte] + 1);
     return;
   }
 
   if (dscPanelData[dscPanelByte] >= 0x40 && dscPanelData[dscPanelByte] <= 0x5F) {
-    printf("Zone tamper: %d", dscPanelData[dscPanelByte] - 31);
+    dscPrintf("Zone tamper: %d", dscPanelData[dscPanelByte] - 31);
     return;
   }
 
   if (dscPanelData[dscPanelByte] >= 0x60 && dscPanelData[dscPanelByte] <= 0x7F) {
-    printf("Zone tamper restored: %d", dscPanelData[dscPanelByte] - 63);
+    dscPrintf("Zone tamper restored: %d", dscPanelData[dscPanelByte] - 63);
     return;
   }
 
 
-  printf("Unrecognized data");
+  dscPrintf("Unrecognized data");
 }
 
 
 // Status messages for command 0xEB
 void dscPrintPanelStatus14(byte dscPanelByte) {
   if (dscPanelData[dscPanelByte] >= 0x40 && dscPanelData[dscPanelByte] <= 0x5F) {
-    printf("Zone fault restored: %d", dscPanelData[dscPanelByte] - 31);
+    dscPrintf("Zone fault restored: %d", dscPanelData[dscPanelByte] - 31);
     return;
   }
 
   if (dscPanelData[dscPanelByte] >= 0x60 && dscPanelData[dscPanelByte] <= 0x7F) {
-    printf("Zone fault: %d", dscPanelData[dscPanelByte] - 63);
+    dscPrintf("Zone fault: %d", dscPanelData[dscPanelByte] - 63);
     return;
   }
 
 
-  printf("Unrecognized data");
+  dscPrintf("Unrecognized data");
 }
 
 
@@ -586,7 +724,7 @@ void dscPrintPanelStatus14(byte dscPanelByte) {
 void dscPrintPanelBitNumbers(byte dscPanelByte, byte startNumber) {
   for (byte bit = 0; bit < 8; bit++) {
     if (bitRead(dscPanelData[dscPanelByte],bit)) {
-      printf("%d ", startNumber + bit);
+      dscPrintf("%d ", startNumber + bit);
     }
   }
 }
@@ -633,39 +771,39 @@ void dscPrintPanelBitNumbers(byte dscPanelByte, byte startNumber) {
  *  00000101 0 10000000 00000011 10000010 00000101 10000010 00000101 00000000 11000111 [0x05] Status lights: Backlight | Zones open
  */
 void dscPrintPanel_0x05() {
-  printf("Partition 1: ");
+  dscPrintf("Partition 1: ");
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 
   if (dscPanelData[5] == 0xC7) {
-    printf(" | Partition 2: disabled");
+    dscPrintf(" | Partition 2: disabled");
   }
   else {
-    printf(" | Partition 2: ");
+    dscPrintf(" | Partition 2: ");
     dscPrintPanelLights(4);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(5);
   }
 
   if (dscPanelByteCount > 9) {
     if (dscPanelData[7] == 0xC7) {
-      printf(" | Partition 3: disabled");
+      dscPrintf(" | Partition 3: disabled");
     }
     else {
-      printf(" | Partition 3: ");
+      dscPrintf(" | Partition 3: ");
       dscPrintPanelLights(6);
-      printf("- ");
+      dscPrintf("- ");
       dscPrintPanelMessages(7);
     }
 
     if (dscPanelData[9] == 0xC7) {
-      printf(" | Partition 4: disabled");
+      dscPrintf(" | Partition 4: disabled");
     }
     else {
-      printf(" | Partition 4: ");
+      dscPrintf(" | Partition 4: ");
       dscPrintPanelLights(8);
-      printf("- ");
+      dscPrintf("- ");
       dscPrintPanelMessages(9);
     }
   }
@@ -685,23 +823,18 @@ void dscPrintPanel_0x05() {
  *  00001010 0 10000001 11101110 01100101 00000000 00000000 00000000 00000000 11011110 [0x0A] Status lights: Ready | Zone lights: 1 3 6 7
  */
 void dscPrintPanel_0x0A() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 
   bool zoneLights = false;
-  printf(" | Zone lights: ");
+  dscPrintf(" | Zone lights: ");
   for (byte dscPanelByte = 4; dscPanelByte < 8; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte-4) *  8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte-4) *  8));
         }
       }
     }
@@ -709,13 +842,13 @@ void dscPrintPanel_0x0A() {
 
   if (dscPanelData[8] != 0 && dscPanelData[8] != 128) {
     zoneLights = true;
-    if (bitRead(dscPanelData[8],0)) printf("33 ");
-    if (bitRead(dscPanelData[8],1)) printf("34 ");
-    if (bitRead(dscPanelData[8],3)) printf("41 ");
-    if (bitRead(dscPanelData[8],4)) printf("42 ");
+    if (bitRead(dscPanelData[8],0)) dscPrintf("33 ");
+    if (bitRead(dscPanelData[8],1)) dscPrintf("34 ");
+    if (bitRead(dscPanelData[8],3)) dscPrintf("41 ");
+    if (bitRead(dscPanelData[8],4)) dscPrintf("42 ");
   }
 
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
 
 
@@ -729,7 +862,7 @@ void dscPrintPanel_0x0A() {
  *  11111111 1 11111111 11111100 11111111 11111111 11111111 [Keypad] Slot 8
  */
 void dscPrintPanel_0x11() {
-  printf("Keypad slot query");
+  dscPrintf("Keypad slot query");
 }
 
 
@@ -754,41 +887,37 @@ void dscPrintPanel_0x11() {
  *  00010110 0 00001110 01000010 10110001 00010111 [0x16] PC1864 | Zone wiring: NC | Armed
  */
 void dscPrintPanel_0x16() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   if (dscPanelData[2] == 0x0E) {
 
     switch (dscPanelData[3]) {
-      case 0x10: printf("PC5015 "); break;
-      case 0x23: printf("PC1555MX "); break;
-      case 0x41: printf("PC1832 "); break;
-      case 0x42: printf("PC1864 "); break;
-      default: printf("Unknown panel "); break;
+      case 0x10: dscPrintf("PC5015 "); break;
+      case 0x23: dscPrintf("PC1555MX "); break;
+      case 0x41: dscPrintf("PC1832 "); break;
+      case 0x42: dscPrintf("PC1864 "); break;
+      default: dscPrintf("Unknown panel "); break;
     }
 
     switch (dscPanelData[4] & 0x03) {
-      case 0x01: printf("| Zone wiring: NC "); break;
-      case 0x02: printf("| Zone wiring: EOL "); break;
-      case 0x03: printf("| Zone wiring: DEOL "); break;
+      case 0x01: dscPrintf("| Zone wiring: NC "); break;
+      case 0x02: dscPrintf("| Zone wiring: EOL "); break;
+      case 0x03: dscPrintf("| Zone wiring: DEOL "); break;
     }
 
     switch (dscPanelData[4] >> 2) {
-      case 0x2C: printf("| Armed"); break;
-      case 0x2D: printf("| Interval 4m"); break;
-      case 0x34: printf("| Exit *8 programming"); break;
-      case 0x39: printf("| *8 programming"); break;
-      case 0x3C: printf("| Armed, Exit *8 +15s, Power-on +2m"); break;
-      case 0x3D: printf("| Interval 4m"); break;
-      default: printf("| Unrecognized data"); break;
+      case 0x2C: dscPrintf("| Armed"); break;
+      case 0x2D: dscPrintf("| Interval 4m"); break;
+      case 0x34: dscPrintf("| Exit *8 programming"); break;
+      case 0x39: dscPrintf("| *8 programming"); break;
+      case 0x3C: dscPrintf("| Armed, Exit *8 +15s, Power-on +2m"); break;
+      case 0x3D: dscPrintf("| Interval 4m"); break;
+      default: dscPrintf("| Unrecognized data"); break;
     }
   }
-  else printf("Unrecognized data");
+  else dscPrintf("Unrecognized data");
 }
 
 
+#if dscPartitions > 4
 /*
  *  0x1B: Status - partitions 5-8
  *  Interval: constant
@@ -807,45 +936,46 @@ void dscPrintPanel_0x16() {
 void dscPrintPanel_0x1B() {
 
   if (dscPanelData[3] == 0xC7) {
-    printf("Partition 5: disabled");
+    dscPrintf("Partition 5: disabled");
   }
   else {
-    printf("Partition 5: ");
+    dscPrintf("Partition 5: ");
     dscPrintPanelLights(2);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(3);
   }
 
   if (dscPanelData[5] == 0xC7) {
-    printf(" | Partition 6: disabled");
+    dscPrintf(" | Partition 6: disabled");
   }
   else {
-    printf(" | Partition 6: ");
+    dscPrintf(" | Partition 6: ");
     dscPrintPanelLights(4);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(5);
   }
 
   if (dscPanelData[7] == 0xC7) {
-    printf(" | Partition 7: disabled");
+    dscPrintf(" | Partition 7: disabled");
   }
   else {
-    printf(" | Partition 7: ");
+    dscPrintf(" | Partition 7: ");
     dscPrintPanelLights(6);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(7);
   }
 
   if (dscPanelData[9] == 0xC7) {
-    printf(" | Partition 8: disabled");
+    dscPrintf(" | Partition 8: disabled");
   }
   else {
-    printf(" | Partition 8: ");
+    dscPrintf(" | Partition 8: ");
     dscPrintPanelLights(8);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(9);
   }
 }
+#endif
 
 
 /*
@@ -858,7 +988,7 @@ void dscPrintPanel_0x1B() {
  *  01110111 1  [Keypad] Fire alarm
  */
 void dscPrintPanel_0x1C() {
-  printf("Verify keypad Fire/Auxiliary/Panic");
+  dscPrintf("Verify keypad Fire/Auxiliary/Panic");
 }
 
 
@@ -890,28 +1020,23 @@ void dscPrintPanel_0x1C() {
  *  00100111 0 10000000 00000011 10000010 00000101 00011101 01001110 [0x27] Status lights: Backlight | Zones open | Zones 1-8 open: 1 3 4 5  // PC1832
  */
 void dscPrintPanel_0x27() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1: ");
+  dscPrintf("Partition 1: ");
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 
   if (dscPanelData[5] == 0xC7) {
-    printf(" | Partition 2: disabled");
+    dscPrintf(" | Partition 2: disabled");
   }
   else if (dscPanelData[5] != 0xFF) {
-    printf(" | Partition 2: ");
+    dscPrintf(" | Partition 2: ");
     dscPrintPanelLights(4);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(5);
   }
 
-  printf(" | Zones 1-8 open: ");
-  if (dscPanelData[6] == 0) printf("none");
+  dscPrintf(" | Zones 1-8 open: ");
+  if (dscPanelData[6] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(6,1);
   }
@@ -927,7 +1052,7 @@ void dscPrintPanel_0x27() {
  *  11111111 1 01010111 01010101 11111111 11111111 01101111 [Zone Expander] Status
  */
 void dscPrintPanel_0x28() {
-  printf("Zone expander query");
+  dscPrintf("Zone expander query");
 }
 
 
@@ -945,28 +1070,23 @@ void dscPrintPanel_0x28() {
  *  00101101 0 10000000 00000011 10000010 00000101 00000000 00110111 [0x2D] Status lights: Backlight | Zones open | Zones 9-16 open: none  // PC1832
  */
 void dscPrintPanel_0x2D() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1: ");
+  dscPrintf("Partition 1: ");
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 
   if (dscPanelData[5] == 0xC7) {
-    printf(" | Partition 2: disabled");
+    dscPrintf(" | Partition 2: disabled");
   }
   else if (dscPanelData[5] != 0xFF) {
-    printf(" | Partition 2: ");
+    dscPrintf(" | Partition 2: ");
     dscPrintPanelLights(4);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(5);
   }
 
-  printf(" | Zones 9-16 open: ");
-  if (dscPanelData[6] == 0) printf("none");
+  dscPrintf(" | Zones 9-16 open: ");
+  if (dscPanelData[6] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(6,9);
   }
@@ -984,28 +1104,23 @@ void dscPrintPanel_0x2D() {
  *  Byte 6: Zones 17-24
  */
 void dscPrintPanel_0x34() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1: ");
+  dscPrintf("Partition 1: ");
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 
   if (dscPanelData[5] == 0xC7) {
-    printf(" | Partition 2: disabled");
+    dscPrintf(" | Partition 2: disabled");
   }
   else if (dscPanelData[5] != 0xFF) {
-    printf(" | Partition 2: ");
+    dscPrintf(" | Partition 2: ");
     dscPrintPanelLights(4);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(5);
   }
 
-  printf(" | Zones 17-24 open: ");
-  if (dscPanelData[6] == 0) printf("none");
+  dscPrintf(" | Zones 17-24 open: ");
+  if (dscPanelData[6] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(6,17);
   }
@@ -1023,28 +1138,23 @@ void dscPrintPanel_0x34() {
  *  Byte 6: Zones 25-32
  */
 void dscPrintPanel_0x3E() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1: ");
+  dscPrintf("Partition 1: ");
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 
   if (dscPanelData[5] == 0xC7) {
-    printf(" | Partition 2: disabled");
+    dscPrintf(" | Partition 2: disabled");
   }
   else if (dscPanelData[5] != 0xFF) {
-    printf(" | Partition 2: ");
+    dscPrintf(" | Partition 2: ");
     dscPrintPanelLights(4);
-    printf("- ");
+    dscPrintf("- ");
     dscPrintPanelMessages(5);
   }
 
-  printf(" | Zones 25-32 open: ");
-  if (dscPanelData[6] == 0) printf("none");
+  dscPrintf(" | Zones 25-32 open: ");
+  if (dscPanelData[6] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(6,25);
   }
@@ -1060,7 +1170,7 @@ void dscPrintPanel_0x3E() {
  *  01001100 0 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 [0x4C] Keybus query
  */
 void dscPrintPanel_0x4C() {
-  printf("Keybus query");
+  dscPrintf("Keybus query");
 }
 
 
@@ -1075,7 +1185,7 @@ void dscPrintPanel_0x4C() {
  *  10100101 0 00011000 01010101 01000000 11010111 10110011 11111111 11011011 [0xA5] 05/10/2018 00:53 | Unrecognized data, add to 0xA5_Byte7_0xFF, Byte 6: 0xB3
  */
 void dscPrintPanel_0x58() {
-  printf("Keybus query");
+  dscPrintf("Keybus query");
 }
 
 
@@ -1096,27 +1206,22 @@ void dscPrintPanel_0x58() {
  *  01011101 0 00000000 00000000 00000001 00000000 00000000 01011110 [0x5D] Partition 1 | Status lights flashing: none | Zones flashing: 9
  */
 void dscPrintPanel_0x5D() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1 | Status lights flashing: ");
+  dscPrintf("Partition 1 | Status lights flashing: ");
   dscPrintPanelLights(2);
 
   bool zoneLights = false;
-  printf("| Zones 1-32 flashing: ");
+  dscPrintf("| Zones 1-32 flashing: ");
   for (byte dscPanelByte = 3; dscPanelByte <= 6; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte-3) *  8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte-3) *  8));
         }
       }
     }
   }
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
 
 
@@ -1134,27 +1239,22 @@ void dscPrintPanel_0x5D() {
  *  01100011 0 00000100 10000000 00000000 00000000 00000000 11100111 [0x63] Partition 2 | Status lights flashing:Memory | Zones 1-32 flashing: 8
  */
 void dscPrintPanel_0x63() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 2 | Status lights flashing: ");
+  dscPrintf("Partition 2 | Status lights flashing: ");
   dscPrintPanelLights(2);
 
   bool zoneLights = false;
-  printf("| Zones 1-32 flashing: ");
+  dscPrintf("| Zones 1-32 flashing: ");
   for (byte dscPanelByte = 3; dscPanelByte <= 6; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte-3) *  8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte-3) *  8));
         }
       }
     }
   }
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
 
 
@@ -1165,18 +1265,13 @@ void dscPrintPanel_0x63() {
  *  01100100 0 00001100 01110000 [0x64] Partition 1 | Beep: 6 beeps
  */
 void dscPrintPanel_0x64() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1 | Beep: ");
+  dscPrintf("Partition 1 | Beep: ");
   switch (dscPanelData[2]) {
-    case 0x04: printf("2 beeps"); break;
-    case 0x06: printf("3 beeps"); break;
-    case 0x08: printf("4 beeps"); break;
-    case 0x0C: printf("6 beeps"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x04: dscPrintf("2 beeps"); break;
+    case 0x06: dscPrintf("3 beeps"); break;
+    case 0x08: dscPrintf("4 beeps"); break;
+    case 0x0C: dscPrintf("6 beeps"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1188,18 +1283,13 @@ void dscPrintPanel_0x64() {
  *  01101001 0 00001100 01110101 [0x69] Partition 2 | Beep: 6 beeps
  */
 void dscPrintPanel_0x69() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 2 | Beep: ");
+  dscPrintf("Partition 2 | Beep: ");
   switch (dscPanelData[2]) {
-    case 0x04: printf("2 beeps"); break;
-    case 0x06: printf("3 beeps"); break;
-    case 0x08: printf("4 beeps"); break;
-    case 0x0C: printf("6 beeps"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x04: dscPrintf("2 beeps"); break;
+    case 0x06: dscPrintf("3 beeps"); break;
+    case 0x08: dscPrintf("4 beeps"); break;
+    case 0x0C: dscPrintf("6 beeps"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1212,19 +1302,14 @@ void dscPrintPanel_0x69() {
  *  01110101 0 00000000 01110101 [0x75] Partition 1 | Beep pattern: off
  */
 void dscPrintPanel_0x75() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1 | Beep pattern: ");
+  dscPrintf("Partition 1 | Beep pattern: ");
   switch (dscPanelData[2]) {
-    case 0x00: printf("off"); break;
-    case 0x11: printf("single beep (exit delay)"); break;
-    case 0x31: printf("triple beep (exit delay)"); break;
-    case 0x80: printf("solid tone"); break;
-    case 0xB1: printf("triple beep (entrance delay)"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x00: dscPrintf("off"); break;
+    case 0x11: dscPrintf("single beep (exit delay)"); break;
+    case 0x31: dscPrintf("triple beep (exit delay)"); break;
+    case 0x80: dscPrintf("solid tone"); break;
+    case 0xB1: dscPrintf("triple beep (entrance delay)"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1236,19 +1321,14 @@ void dscPrintPanel_0x75() {
  *  01111010 0 00000000 01111010 [0x7A] Partition 2 | Beep pattern: off
  */
 void dscPrintPanel_0x7A() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 2 | Beep pattern: ");
+  dscPrintf("Partition 2 | Beep pattern: ");
   switch (dscPanelData[2]) {
-    case 0x00: printf("off"); break;
-    case 0x11: printf("single beep (exit delay)"); break;
-    case 0x31: printf("triple beep (exit delay)"); break;
-    case 0x80: printf("solid tone"); break;
-    case 0xB1: printf("triple beep (entrance delay)"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x00: dscPrintf("off"); break;
+    case 0x11: dscPrintf("single beep (exit delay)"); break;
+    case 0x31: dscPrintf("triple beep (exit delay)"); break;
+    case 0x80: dscPrintf("solid tone"); break;
+    case 0xB1: dscPrintf("triple beep (entrance delay)"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1260,16 +1340,11 @@ void dscPrintPanel_0x7A() {
  *  01111111 0 00000001 10000000 [0x7F] Beep: long beep
  */
 void dscPrintPanel_0x7F() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 1 | ");
+  dscPrintf("Partition 1 | ");
   switch (dscPanelData[2]) {
-    case 0x01: printf("Beep: long beep"); break;
-    case 0x02: printf("Beep: long beep | Failed to arm"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x01: dscPrintf("Beep: long beep"); break;
+    case 0x02: dscPrintf("Beep: long beep | Failed to arm"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1281,16 +1356,11 @@ void dscPrintPanel_0x7F() {
  *  01111111 0 00000001 10000000 [0x82] Beep: long beep
  */
 void dscPrintPanel_0x82() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Partition 2 | ");
+  dscPrintf("Partition 2 | ");
   switch (dscPanelData[2]) {
-    case 0x01: printf("Beep: long beep"); break;
-    case 0x02: printf("Beep: long beep | Failed to arm"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x01: dscPrintf("Beep: long beep"); break;
+    case 0x02: dscPrintf("Beep: long beep | Failed to arm"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1306,32 +1376,27 @@ void dscPrintPanel_0x82() {
  *  10000111 0 00000000 00001000 10001111 [0x87] Panel output: Bell off | Unrecognized command: Add to 0x87
  */
 void dscPrintPanel_0x87() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Panel output:");
+  dscPrintf("Panel output:");
   switch (dscPanelData[2] & 0xF0) {
-    case 0xF0: printf(" Bell on"); break;
-    default: printf(" Bell off"); break;
+    case 0xF0: dscPrintf(" Bell on"); break;
+    default: dscPrintf(" Bell off"); break;
   }
 
   if ((dscPanelData[3] & 0x0F) <= 0x03) {
-    if (bitRead(dscPanelData[3],0)) printf(" | PGM1 on");
-    else printf(" | PGM1 off");
+    if (bitRead(dscPanelData[3],0)) dscPrintf(" | PGM1 on");
+    else dscPrintf(" | PGM1 off");
 
-    if (bitRead(dscPanelData[3],1)) printf(" | PGM2 on");
-    else printf(" | PGM2 off");
+    if (bitRead(dscPanelData[3],1)) dscPrintf(" | PGM2 on");
+    else dscPrintf(" | PGM2 off");
   }
-  else printf(" | Unrecognized data");
+  else dscPrintf(" | Unrecognized data");
 
   if ((dscPanelData[2] & 0x0F) != 0x0F) {
-    if (bitRead(dscPanelData[2],0)) printf(" | PGM3 on");
-    else printf(" | PGM3 off");
+    if (bitRead(dscPanelData[2],0)) dscPrintf(" | PGM3 on");
+    else dscPrintf(" | PGM3 off");
 
-    if (bitRead(dscPanelData[2],1)) printf(" | PGM4 on");
-    else printf(" | PGM4 off");
+    if (bitRead(dscPanelData[2],1)) dscPrintf(" | PGM4 on");
+    else dscPrintf(" | PGM4 off");
   }
 }
 
@@ -1357,12 +1422,7 @@ void dscPrintPanel_0x87() {
  *  10001101 0 00110001 00110000 00000000 00000000 11111111 11111111 11111111 11101011 [0x8D]   // Message after 4th key entered
  */
 void dscPrintPanel_0x8D() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("User code programming key response");
+  dscPrintf("User code programming key response");
 }
 
 
@@ -1384,9 +1444,9 @@ void dscPrintPanel_0x8D() {
  */
 void dscPrintPanel_0x94() {
   switch (dscPanelData[9]) {
-    case 0x17: printf("Unknown command 1"); break;
-    case 0x4C: printf("Unknown command 2"); break;
-    default: printf("Unrecognized data");
+    case 0x17: dscPrintf("Unknown command 1"); break;
+    case 0x4C: dscPrintf("Unknown command 2"); break;
+    default: dscPrintf("Unrecognized data");
   }
 }
 
@@ -1396,11 +1456,6 @@ void dscPrintPanel_0x94() {
  *  CRC: yes
  */
 void dscPrintPanel_0xA5() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   /*
    *  Date and time
    *  Interval: 4m
@@ -1416,34 +1471,34 @@ void dscPrintPanel_0xA5() {
   byte dscHour = dscPanelData[4] & 0x1F;
   byte dscMinute = dscPanelData[5] >> 2;
 
-  if (dscYear3 >= 7) printf("19");
-  else printf("20");
-  printf("%d%d.%02d.%02d %02d:%02d", dscYear3, dscYear4, dscMonth, dscDay, dscHour, dscMinute);
-
-  /*printf("%d", dscYear3);
-  printf("%d", dscYear4);
-  printf(".");
-  if (dscMonth < 10) printf("0");
-  printf("%d", dscMonth);
-  printf(".");
-  if (dscDay < 10) printf("0");
-  printf("%d", dscDay);
-  printf(" ");
-  if (dscHour < 10) printf("0");
-  printf("%d", dscHour);
-  printf(":");
-  if (dscMinute < 10) printf("0");
-  printf("%d", dscMinute);*/
+  if (dscYear3 >= 7) dscPrintf("19");
+  else dscPrintf("20");
+  dscPrintf("%d%d.%02d.%02d %02d:%02d", dscYear3, dscYear4, dscMonth, dscDay, dscHour, dscMinute);
+
+  /*dscPrintf("%d", dscYear3);
+  dscPrintf("%d", dscYear4);
+  dscPrintf(".");
+  if (dscMonth < 10) dscPrintf("0");
+  dscPrintf("%d", dscMonth);
+  dscPrintf(".");
+  if (dscDay < 10) dscPrintf("0");
+  dscPrintf("%d", dscDay);
+  dscPrintf(" ");
+  if (dscHour < 10) dscPrintf("0");
+  dscPrintf("%d", dscHour);
+  dscPrintf(":");
+  if (dscMinute < 10) dscPrintf("0");
+  dscPrintf("%d", dscMinute);*/
 
   if (dscPanelData[6] == 0 && dscPanelData[7] == 0) {
-    printf(" | Timestamp");
+    dscPrintf(" | Timestamp");
     return;
   }
 
   switch (dscPanelData[3] >> 6) {
-    case 0x00: printf(" | "); break;
-    case 0x01: printf(" | Partition 1 | "); break;
-    case 0x02: printf(" | Partition 2 | "); break;
+    case 0x00: dscPrintf(" | "); break;
+    case 0x01: dscPrintf(" | Partition 1 | "); break;
+    case 0x02: dscPrintf(" | Partition 2 | "); break;
   }
 
   switch (dscPanelData[5] & 0x03) {
@@ -1468,38 +1523,33 @@ void dscPrintPanel_0xA5() {
  *  10110001 0 01111111 11111111 00000000 00000000 10000000 00000000 00000000 00000000 10101111 [0xB1] Enabled zones - Partition 1: 1 2 3 4 5 6 7 9 10 11 12 13 14 15 16 | Partition 2: 8
  */
 void dscPrintPanel_0xB1() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   bool enabledZones = false;
-  printf("Enabled zones 1-32 | Partition 1: ");
+  dscPrintf("Enabled zones 1-32 | Partition 1: ");
   for (byte dscPanelByte = 2; dscPanelByte <= 5; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       enabledZones = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte - 2) * 8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte - 2) * 8));
         }
       }
     }
   }
-  if (!enabledZones) printf("none ");
+  if (!enabledZones) dscPrintf("none ");
 
   enabledZones = false;
-  printf("| Partition 2: ");
+  dscPrintf("| Partition 2: ");
   for (byte dscPanelByte = 6; dscPanelByte <= 9; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       enabledZones = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte - 6) * 8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte - 6) * 8));
         }
       }
     }
   }
-  if (!enabledZones) printf("none");
+  if (!enabledZones) dscPrintf("none");
 }
 
 
@@ -1512,14 +1562,9 @@ void dscPrintPanel_0xB1() {
  *  10111011 0 00000000 00000000 10111011 [0xBB] Bell: off
  */
 void dscPrintPanel_0xBB() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  printf("Bell: ");
-  if (bitRead(dscPanelData[2],5)) printf("on");
-  else printf("off");
+  dscPrintf("Bell: ");
+  if (bitRead(dscPanelData[2],5)) dscPrintf("on");
+  else dscPrintf("off");
 }
 
 
@@ -1533,21 +1578,16 @@ void dscPrintPanel_0xBB() {
  *  11000011 0 00000000 11111111 11000010 [0xC3] Keypad ready
  */
 void dscPrintPanel_0xC3() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   if (dscPanelData[3] == 0xFF) {
     switch (dscPanelData[2]) {
-      case 0x00: printf("Keypad ready"); break;
-      case 0x10: printf("Unknown command 1: Power-on +33s"); break;
+      case 0x00: dscPrintf("Keypad ready"); break;
+      case 0x10: dscPrintf("Unknown command 1: Power-on +33s"); break;
       case 0x30:
-      case 0x40: printf("Keypad lockout"); break;
-      default: printf("Unrecognized data"); break;
+      case 0x40: dscPrintf("Keypad lockout"); break;
+      default: dscPrintf("Unrecognized data"); break;
     }
   }
-  else printf("Unrecognized data");
+  else dscPrintf("Unrecognized data");
 }
 
 
@@ -1562,24 +1602,19 @@ void dscPrintPanel_0xC3() {
  * 11001110 0 01000000 11111111 11111111 11111111 11111111 00001010 [0xCE]  // Partition 1,2 activity
  */
 void dscPrintPanel_0xCE() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   switch (dscPanelData[2]) {
     case 0x01: {
       switch (dscPanelData[3]) {
-        case 0xA0: printf("Partition 1,2 exit delay, partition 1,2 disarmed"); break;
-        case 0xA4: printf("Partition 2 armed away"); break;
-        case 0xB1: printf("Partition 1 armed stay"); break;
-        case 0xB3: printf("Partition 1 armed away"); break;
-        default: printf("Unrecognized data"); break;
+        case 0xA0: dscPrintf("Partition 1,2 exit delay, partition 1,2 disarmed"); break;
+        case 0xA4: dscPrintf("Partition 2 armed away"); break;
+        case 0xB1: dscPrintf("Partition 1 armed stay"); break;
+        case 0xB3: dscPrintf("Partition 1 armed away"); break;
+        default: dscPrintf("Unrecognized data"); break;
       }
       break;
     }
-    case 0x40: printf("Partition 1,2 activity"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x40: dscPrintf("Partition 1,2 activity"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
 
@@ -1592,7 +1627,7 @@ void dscPrintPanel_0xCE() {
  *  11111111 1 11111111 11111111 11111111 11111111 11111111 11111111 11111111 00001111 [Keypad] Slot 8
  */
 void dscPrintPanel_0xD5() {
-  printf("Keypad zone query");
+  dscPrintf("Keypad zone query");
 }
 
 
@@ -1602,87 +1637,76 @@ void dscPrintPanel_0xD5() {
  *  Panels: PC5020, PC1616, PC1832, PC1864
  */
 void dscPrintPanel_0xE6() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
-  switch (dscPanelData[2]) {
-    case 0x03: dscPrintPanel_0xE6_0x03(); break;  // Status in alarm/programming, partitions 5-8
-    case 0x09: dscPrintPanel_0xE6_0x09(); break;  // Zones 33-40 status
-    case 0x0B: dscPrintPanel_0xE6_0x0B(); break;  // Zones 41-48 status
-    case 0x0D: dscPrintPanel_0xE6_0x0D(); break;  // Zones 49-56 status
-    case 0x0F: dscPrintPanel_0xE6_0x0F(); break;  // Zones 57-64 status
-    case 0x17: dscPrintPanel_0xE6_0x17(); break;  // Flash panel lights: status and zones 1-32, partitions 1-8
-    case 0x18: dscPrintPanel_0xE6_0x18(); break;  // Flash panel lights: status and zones 33-64, partitions 1-8
-    case 0x19: dscPrintPanel_0xE6_0x19(); break;  // Beep - one-time, partitions 3-8
-    case 0x1A: dscPrintPanel_0xE6_0x1A(); break;  // Unknown command
-    case 0x1D: dscPrintPanel_0xE6_0x1D(); break;  // Beep pattern, partitions 3-8
-    case 0x20: dscPrintPanel_0xE6_0x20(); break;  // Status in programming, zone lights 33-64
-    case 0x2B: dscPrintPanel_0xE6_0x2B(); break;  // Enabled zones 1-32, partitions 3-8
-    case 0x2C: dscPrintPanel_0xE6_0x2C(); break;  // Enabled zones 33-64, partitions 3-8
-    case 0x41: dscPrintPanel_0xE6_0x41(); break;  // Status in access code programming, zone lights 65-95
-    default: printf("Unrecognized data");
-  }
+  dscPrintf("Unrecognized data");  // Known subcommands are printed from dscPanelCommandsE6[]
 }
 
 
+#if dscPartitions > 4
 /*
  *  0xE6_0x03: Status in alarm/programming, partitions 5-8
  */
 void dscPrintPanel_0xE6_0x03() {
   dscPrintPanelLights(2);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(3);
 }
+#endif
 
 
+#if dscZones > 4
 /*
  *  0xE6_0x09: Zones 33-40 status
  */
 void dscPrintPanel_0xE6_0x09() {
-  printf("Zones 33-40 open: ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Zones 33-40 open: ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,33);
   }
 }
+#endif
 
 
+#if dscZones > 5
 /*
  *  0xE6_0x0B: Zones 41-48 status
  */
 void dscPrintPanel_0xE6_0x0B() {
-  printf("Zones 41-48 open: ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Zones 41-48 open: ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,41);
   }
 }
+#endif
 
 
+#if dscZones > 6
 /*
  *  0xE6_0x0D: Zones 49-56 status
  */
 void dscPrintPanel_0xE6_0x0D() {
-  printf("Zones 49-56 open: ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Zones 49-56 open: ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,49);
   }
 }
+#endif
 
 
+#if dscZones > 7
 /*
  *  0xE6_0x0F: Zones 57-64 status
  */
 void dscPrintPanel_0xE6_0x0F() {
-  printf("Zones 57-64 open: ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Zones 57-64 open: ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,57);
   }
 }
+#endif
 
 
 /*
@@ -1691,31 +1715,32 @@ void dscPrintPanel_0xE6_0x0F() {
  *  11100110 0 00010111 00000100 00000000 00000100 00000000 00000000 00000000 00000101 [0xE6] Partition 3 |  // Zone 3
  */
 void dscPrintPanel_0xE6_0x17() {
-  printf("Partition ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Partition ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,1);
   }
 
-  printf("| Status lights flashing: ");
+  dscPrintf("| Status lights flashing: ");
   dscPrintPanelLights(4);
 
   bool zoneLights = false;
-  printf("| Zones 1-32 flashing: ");
+  dscPrintf("| Zones 1-32 flashing: ");
   for (byte dscPanelByte = 5; dscPanelByte <= 8; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte-5) *  8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte-5) *  8));
         }
       }
     }
   }
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
 
 
+#if dscZones > 4
 /*
  *  0xE6_0x18: Flash panel lights: status and zones 33-64, partitions 1-8
  *
@@ -1723,78 +1748,83 @@ void dscPrintPanel_0xE6_0x17() {
  *  11100110 0 00011000 00000001 00000100 00000000 00000000 00000000 10000000 10000011 [0xE6] Partition 1 |  // Zone 64
  */
 void dscPrintPanel_0xE6_0x18() {
-  printf("Partition ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Partition ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,1);
   }
 
-  printf("| Status lights flashing: ");
+  dscPrintf("| Status lights flashing: ");
   dscPrintPanelLights(4);
 
   bool zoneLights = false;
-  printf("| Zones 33-64 flashing: ");
+  dscPrintf("| Zones 33-64 flashing: ");
   for (byte dscPanelByte = 5; dscPanelByte <= 8; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 33) + ((dscPanelByte-5) *  8));
+          dscPrintf("%d ", (zoneBit + 33) + ((dscPanelByte-5) *  8));
         }
       }
     }
   }
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
+#endif
 
 
+#if dscPartitions > 2
 /*
  *  0xE6_0x19: Beep - one time, partitions 3-8
  */
 void dscPrintPanel_0xE6_0x19() {
-  printf("Partition ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Partition ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,1);
   }
 
-  printf("| Beep: ");
+  dscPrintf("| Beep: ");
   switch (dscPanelData[4]) {
-    case 0x04: printf("2 beeps"); break;
-    case 0x06: printf("3 beeps"); break;
-    case 0x08: printf("4 beeps"); break;
-    case 0x0C: printf("6 beeps"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x04: dscPrintf("2 beeps"); break;
+    case 0x06: dscPrintf("3 beeps"); break;
+    case 0x08: dscPrintf("4 beeps"); break;
+    case 0x0C: dscPrintf("6 beeps"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
+#endif
 
 
 void dscPrintPanel_0xE6_0x1A() {
-  printf("0x1A: ");
-  printf("Unrecognized data");
+  dscPrintf("0x1A: ");
+  dscPrintf("Unrecognized data");
 }
 
 
+#if dscPartitions > 2
 /*
  *  0xE6_0x1D: Beep pattern, partitions 3-8
  */
 void dscPrintPanel_0xE6_0x1D() {
-  printf("Partition ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Partition ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,1);
   }
 
-  printf("| Beep pattern: ");
+  dscPrintf("| Beep pattern: ");
   switch (dscPanelData[4]) {
-    case 0x00: printf("off"); break;
-    case 0x11: printf("single beep (exit delay)"); break;
-    case 0x31: printf("triple beep (exit delay)"); break;
-    case 0x80: printf("solid tone"); break;
-    case 0xB1: printf("triple beep (entrance delay)"); break;
-    default: printf("Unrecognized data"); break;
+    case 0x00: dscPrintf("off"); break;
+    case 0x11: dscPrintf("single beep (exit delay)"); break;
+    case 0x31: dscPrintf("triple beep (exit delay)"); break;
+    case 0x80: dscPrintf("solid tone"); break;
+    case 0xB1: dscPrintf("triple beep (entrance delay)"); break;
+    default: dscPrintf("Unrecognized data"); break;
   }
 }
+#endif
 
 
 /*
@@ -1803,78 +1833,82 @@ void dscPrintPanel_0xE6_0x1D() {
  *  CRC: yes
  */
 void dscPrintPanel_0xE6_0x20() {
-  printf("Status lights: ");
+  dscPrintf("Status lights: ");
   dscPrintPanelLights(3);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(4);
 
   bool zoneLights = false;
-  printf(" | Zone lights: ");
+  dscPrintf(" | Zone lights: ");
   for (byte dscPanelByte = 5; dscPanelByte <= 8; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 33) + ((dscPanelByte-5) *  8));
+          dscPrintf("%d ", (zoneBit + 33) + ((dscPanelByte-5) *  8));
         }
       }
     }
   }
 
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
 
 
+#if dscPartitions > 2
 /*
  *  0xE6_0x2B: Enabled zones 1-32, partitions 3-8
  */
 void dscPrintPanel_0xE6_0x2B() {
-  printf("Partition ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Partition ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,1);
   }
 
   bool enabledZones = false;
-  printf("| Enabled zones  1-32: ");
+  dscPrintf("| Enabled zones  1-32: ");
   for (byte dscPanelByte = 4; dscPanelByte <= 7; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       enabledZones = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 1) + ((dscPanelByte - 4) * 8));
+          dscPrintf("%d ", (zoneBit + 1) + ((dscPanelByte - 4) * 8));
         }
       }
     }
   }
-  if (!enabledZones) printf("none");
+  if (!enabledZones) dscPrintf("none");
 }
+#endif
 
 
+#if dscZones > 4
 /*
  *  0xE6_0x2C: Enabled zones 33-64, partitions 1-8
  */
 void dscPrintPanel_0xE6_0x2C() {
-  printf("Partition ");
-  if (dscPanelData[3] == 0) printf("none");
+  dscPrintf("Partition ");
+  if (dscPanelData[3] == 0) dscPrintf("none");
   else {
     dscPrintPanelBitNumbers(3,1);
   }
 
   bool enabledZones = false;
-  printf("| Enabled zones 33-64: ");
+  dscPrintf("| Enabled zones 33-64: ");
   for (byte dscPanelByte = 4; dscPanelByte <= 7; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       enabledZones = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 33) + ((dscPanelByte - 4) * 8));
+          dscPrintf("%d ", (zoneBit + 33) + ((dscPanelByte - 4) * 8));
         }
       }
     }
   }
-  if (!enabledZones) printf("none");
+  if (!enabledZones) dscPrintf("none");
 }
+#endif
 
 
 /*
@@ -1882,25 +1916,25 @@ void dscPrintPanel_0xE6_0x2C() {
  *  CRC: yes
  */
 void dscPrintPanel_0xE6_0x41() {
-  printf("Status lights: ");
+  dscPrintf("Status lights: ");
   dscPrintPanelLights(3);
-  printf("- ");
+  dscPrintf("- ");
   dscPrintPanelMessages(4);
 
   bool zoneLights = false;
-  printf(" | Zone lights: ");
+  dscPrintf(" | Zone lights: ");
   for (byte dscPanelByte = 5; dscPanelByte <= 8; dscPanelByte++) {
     if (dscPanelData[dscPanelByte] != 0) {
       zoneLights = true;
       for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
         if (bitRead(dscPanelData[dscPanelByte],zoneBit)) {
-          printf("%d ", (zoneBit + 65) + ((dscPanelByte-5) *  8));
+          dscPrintf("%d ", (zoneBit + 65) + ((dscPanelByte-5) *  8));
         }
       }
     }
   }
 
-  if (!zoneLights) printf("none");
+  if (!zoneLights) dscPrintf("none");
 }
 
 
@@ -1922,11 +1956,6 @@ void dscPrintPanel_0xE6_0x41() {
  * 11101011 0 00000000 00000001 00000100 01100000 00001100 00010100 01011111 11111111 11001110 [0xEB] 2001.01.03 00:03 | Zone fault restored: 64
  */
 void dscPrintPanel_0xEB() {
-  if (!dscValidCRC()) {
-    printf("[CRC Error]");
-    return;
-  }
-
   byte dscYear3 = dscPanelData[3] >> 4;
   byte dscYear4 = dscPanelData[3] & 0x0F;
   byte dscMonth = dscPanelData[4] << 2; dscMonth >>=4;
@@ -1936,30 +1965,30 @@ void dscPrintPanel_0xEB() {
   byte dscHour = dscPanelData[5] & 0x1F;
   byte dscMinute = dscPanelData[6] >> 2;
 
-  if (dscYear3 >= 7) printf("19");
-  else printf("20");
-  printf("%d%d.%02d.%02d %02d:%02d", dscYear3, dscYear4, dscMonth, dscDay, dscHour, dscMinute);
-
-  /*printf("%d", dscYear3);
-  printf("%d", dscYear4);
-  printf(".");
-  if (dscMonth < 10) printf("0");
-  printf("%d", dscMonth);
-  printf(".");
-  if (dscDay < 10) printf("0");
-  printf("%d", dscDay);
-  printf(" ");
-  if (dscHour < 10) printf("0");
-  printf("%d", dscHour);
-  printf(":");
-  if (dscMinute < 10) printf("0");
-  printf("%d", dscMinute);*/
-
-  if (dscPanelData[2] == 0) printf(" | ");
+  if (dscYear3 >= 7) dscPrintf("19");
+  else dscPrintf("20");
+  dscPrintf("%d%d.%02d.%02d %02d:%02d", dscYear3, dscYear4, dscMonth, dscDay, dscHour, dscMinute);
+
+  /*dscPrintf("%d", dscYear3);
+  dscPrintf("%d", dscYear4);
+  dscPrintf(".");
+  if (dscMonth < 10) dscPrintf("0");
+  dscPrintf("%d", dscMonth);
+  dscPrintf(".");
+  if (dscDay < 10) dscPrintf("0");
+  dscPrintf("%d", dscDay);
+  dscPrintf(" ");
+  if (dscHour < 10) dscPrintf("0");
+  dscPrintf("%d", dscHour);
+  dscPrintf(":");
+  if (dscMinute < 10) dscPrintf("0");
+  dscPrintf("%d", dscMinute);*/
+
+  if (dscPanelData[2] == 0) dscPrintf(" | ");
   else {
-    printf(" | Partition ");
+    dscPrintf(" | Partition ");
     dscPrintPanelBitNumbers(2,1);
-    printf("| ");
+    dscPrintf("| ");
   }
 
   switch (dscPanelData[7]) {
@@ -1984,7 +2013,7 @@ void dscPrintPanel_0xEB() {
  *  01110111 1 11111111 11111111 11111111 11111111 11111111 11111111 [Keypad] Fire alarm
  */
 void dscPrintModule_0x77() {
-  printf("[Keypad] Fire alarm");
+  dscPrintf("[Keypad] Fire alarm");
 }
 
 
@@ -1994,7 +2023,7 @@ void dscPrintModule_0x77() {
  *  10111011 1 11111111 11111111 11111111 11111111 11111111 11111111 [Keypad] Aux alarm
  */
 void dscPrintModule_0xBB() {
-  printf("[Keypad] Auxiliary alarm");
+  dscPrintf("[Keypad] Auxiliary alarm");
 }
 
 
@@ -2004,7 +2033,7 @@ void dscPrintModule_0xBB() {
  *  11011101 1 11111111 11111111 11111111 11111111 11111111 11111111 [Keypad] Panic alarm
  */
 void dscPrintModule_0xDD() {
-  printf("[Keypad] Panic alarm");
+  dscPrintf("[Keypad] Panic alarm");
 }
 
 
@@ -2018,14 +2047,14 @@ void dscPrintModule_Notification() {
     // 11111111 1 11111111 11111111 10111111 11111111 [Zone Expander] Status notification
     // 00101000 0 11111111 11111111 11111111 11111111 11111111 [0x28] Zone expander query
     case 0xBF:
-      printf("[Zone Expander] Status notification");
+      dscPrintf("[Zone Expander] Status notification");
       break;
 
     // Keypad: Unknown Keybus notification, panel responds with 0x4C query
     // 11111111 1 11111111 11111111 11111110 11111111 [Keypad] Unknown Keybus notification
     // 01001100 0 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 [0x4C] Unknown Keybus query
     case 0xFE:
-      printf("[Keypad] Unknown Keybus notification");
+      dscPrintf("[Keypad] Unknown Keybus notification");
       break;
   }
 
@@ -2034,7 +2063,7 @@ void dscPrintModule_Notification() {
     // 11111111 1 11111111 11111111 11111111 11111011 [Keypad] Zone status notification
     // 11010101 0 10101010 10101010 10101010 10101010 10101010 10101010 10101010 10101010 [0xD5] Keypad zone query
     case 0xFB:
-      printf("[Keypad] Zone status notification");
+      dscPrintf("[Keypad] Zone status notification");
       break;
   }
 }
@@ -2047,15 +2076,15 @@ void dscPrintModule_Notification() {
  *  11111111 1 00111111 11111111 11111111 11111111 11111111 [Keypad] Slots active: 1
  */
 void dscPrintModule_Panel_0x11() {
-  printf("[Keypad] Slots active: ");
-  if ((dscModuleData[2] & 0xC0) == 0) printf("1 ");
-  if ((dscModuleData[2] & 0x30) == 0) printf("2 ");
-  if ((dscModuleData[2] & 0x0C) == 0) printf("3 ");
-  if ((dscModuleData[2] & 0x03) == 0) printf("4 ");
-  if ((dscModuleData[3] & 0xC0) == 0) printf("5 ");
-  if ((dscModuleData[3] & 0x30) == 0) printf("6 ");
-  if ((dscModuleData[3] & 0x0C) == 0) printf("7 ");
-  if ((dscModuleData[3] & 0x03) == 0) printf("8 ");
+  dscPrintf("[Keypad] Slots active: ");
+  if ((dscModuleData[2] & 0xC0) == 0) dscPrintf("1 ");
+  if ((dscModuleData[2] & 0x30) == 0) dscPrintf("2 ");
+  if ((dscModuleData[2] & 0x0C) == 0) dscPrintf("3 ");
+  if ((dscModuleData[2] & 0x03) == 0) dscPrintf("4 ");
+  if ((dscModuleData[3] & 0xC0) == 0) dscPrintf("5 ");
+  if ((dscModuleData[3] & 0x30) == 0) dscPrintf("6 ");
+  if ((dscModuleData[3] & 0x0C) == 0) dscPrintf("7 ");
+  if ((dscModuleData[3] & 0x03) == 0) dscPrintf("8 ");
 }
 
 
@@ -2078,16 +2107,16 @@ void dscPrintModule_Panel_0x11() {
  *  11111111 1 00111100 11111111 11111111 11111111 11111111 11111111 11111111 11111111 [Keypad] Slot 1 | Zone closed  //After exiting *8 programming after NC
  */
 void dscPrintModule_Panel_0xD5() {
-  printf("[Keypad] ");
+  dscPrintf("[Keypad] ");
   bool firstData = true;
   for (byte dscModuleByte = 2; dscModuleByte <= 9; dscModuleByte++) {
     byte slotData = dscModuleData[dscModuleByte];
     if (slotData < 0xFF) {
-      if (firstData) printf("Slot ");
-      else printf(" | Slot ");
-      printf("%d", dscModuleByte - 1);
-      if ((slotData & 0x03) == 0x03 && (slotData & 0x30) == 0) printf(" zone open");
-      if ((slotData & 0x03) == 0 && (slotData & 0x30) == 0x30) printf(" zone closed");
+      if (firstData) dscPrintf("Slot ");
+      else dscPrintf(" | Slot ");
+      dscPrintf("%d", dscModuleByte - 1);
+      if ((slotData & 0x03) == 0x03 && (slotData & 0x30) == 0) dscPrintf(" zone open");
+      if ((slotData & 0x03) == 0 && (slotData & 0x30) == 0x30) dscPrintf(" zone closed");
       firstData = false;
     }
   }
@@ -2101,81 +2130,81 @@ void dscPrintModule_Panel_0xD5() {
  *  11111111 1 00101101 11111111 11111111 11111111 [Keypad] #
  */
 void dscPrintModule_Keys() {
-  printf("[Keypad] ");
+  dscPrintf("[Keypad] ");
 
   byte keyByte = 2;
-  if (dscCurrentCmd == 0x05) {
+  if (dscModuleCmd == 0x05) {
     if (dscModuleData[2] != 0xFF) {
-      printf("Partition 1 | Key: ");
+      dscPrintf("Partition 1 | Key: ");
     }
     else if (dscModuleData[3] != 0xFF) {
-      printf("Partition 2 | Key: ");
+      dscPrintf("Partition 2 | Key: ");
       keyByte = 3;
     }
     else if (dscModuleData[8] != 0xFF) {
-      printf("Partition 3 | Key: ");
+      dscPrintf("Partition 3 | Key: ");
       keyByte = 8;
     }
 
     else if (dscModuleData[9] != 0xFF) {
-      printf("Partition 4 | Key: ");
+      dscPrintf("Partition 4 | Key: ");
       keyByte = 9;
     }
   }
-  else if (dscCurrentCmd == 0x1B) {
+  else if (dscModuleCmd == 0x1B) {
     if (dscModuleData[2] != 0xFF) {
-      printf("Partition 5 | Key: ");
+      dscPrintf("Partition 5 | Key: ");
     }
     else if (dscModuleData[3] != 0xFF) {
-      printf("Partition 6 | Key: ");
+      dscPrintf("Partition 6 | Key: ");
       keyByte = 3;
     }
     else if (dscModuleData[8] != 0xFF) {
-      printf("Partition 7 | Key: ");
+      dscPrintf("Partition 7 | Key: ");
       keyByte = 8;
     }
 
     else if (dscModuleData[9] != 0xFF) {
-      printf("Partition 8 | Key: ");
+      dscPrintf("Partition 8 | Key: ");
       keyByte = 9;
     }
   }
 
   switch (dscModuleData[keyByte]) {
-    case 0x00: printf("0"); break;
-    case 0x05: printf("1"); break;
-    case 0x0A: printf("2"); break;
-    case 0x0F: printf("3"); break;
-    case 0x11: printf("4"); break;
-    case 0x16: printf("5"); break;
-    case 0x1B: printf("6"); break;
-    case 0x1C: printf("7"); break;
-    case 0x22: printf("8"); break;
-    case 0x27: printf("9"); break;
-    case 0x28: printf("*"); break;
-    case 0x2D: printf("#"); break;
-    case 0x52: printf("Identified voice prompt help"); break;
-    case 0x70: printf("Command output 3"); break;
-    case 0xAF: printf("Arm stay"); break;
-    case 0xB1: printf("Arm away"); break;
-    case 0xB6: printf("*9 No entry delay arm, requires access code"); break;
-    case 0xBB: printf("Door chime configuration"); break;
-    case 0xBC: printf("*6 System test"); break;
-    case 0xC3: printf("*1 Zone bypass programming"); break;
-    case 0xC4: printf("*2 Trouble menu"); break;
-    case 0xC9: printf("*3 Alarm memory display"); break;
-    case 0xCE: printf("*5 Programming, requires master code"); break;
-    case 0xD0: printf("*6 Programming, requires master code"); break;
-    case 0xD5: printf("Command output 1"); break;
-    case 0xDA: printf("Reset / Command output 2"); break;
-    case 0xDF: printf("General voice prompt help"); break;
-    case 0xE1: printf("Quick exit"); break;
-    case 0xE6: printf("Activate stay/away zones"); break;
-    case 0xEB: printf("Function key [20] Future Use"); break;
-    case 0xEC: printf("Command output 4"); break;
-    case 0xF7: printf("Left/right arrow"); break;
+    case 0x00: dscPrintf("0"); break;
+    case 0x05: dscPrintf("1"); break;
+    case 0x0A: dscPrintf("2"); break;
+    case 0x0F: dscPrintf("3"); break;
+    case 0x11: dscPrintf("4"); break;
+    case 0x16: dscPrintf("5"); break;
+    case 0x1B: dscPrintf("6"); break;
+    case 0x1C: dscPrintf("7"); break;
+    case 0x22: dscPrintf("8"); break;
+    case 0x27: dscPrintf("9"); break;
+    case 0x28: dscPrintf("*"); break;
+    case 0x2D: dscPrintf("#"); break;
+    case 0x52: dscPrintf("Identified voice prompt help"); break;
+    case 0x70: dscPrintf("Command output 3"); break;
+    case 0xAF: dscPrintf("Arm stay"); break;
+    case 0xB1: dscPrintf("Arm away"); break;
+    case 0xB6: dscPrintf("*9 No entry delay arm, requires access code"); break;
+    case 0xBB: dscPrintf("Door chime configuration"); break;
+    case 0xBC: dscPrintf("*6 System test"); break;
+    case 0xC3: dscPrintf("*1 Zone bypass programming"); break;
+    case 0xC4: dscPrintf("*2 Trouble menu"); break;
+    case 0xC9: dscPrintf("*3 Alarm memory display"); break;
+    case 0xCE: dscPrintf("*5 Programming, requires master code"); break;
+    case 0xD0: dscPrintf("*6 Programming, requires master code"); break;
+    case 0xD5: dscPrintf("Command output 1"); break;
+    case 0xDA: dscPrintf("Reset / Command output 2"); break;
+    case 0xDF: dscPrintf("General voice prompt help"); break;
+    case 0xE1: dscPrintf("Quick exit"); break;
+    case 0xE6: dscPrintf("Activate stay/away zones"); break;
+    case 0xEB: dscPrintf("Function key [20] Future Use"); break;
+    case 0xEC: dscPrintf("Command output 4"); break;
+    case 0xF7: dscPrintf("Left/right arrow"); break;
     default:
-      printf("Unrecognized data: 0x%02X", dscModuleData[keyByte]);
+      dscPrintf("Unrecognized data: 0x%02X", dscModuleData[keyByte]);
       break;
   }
 }
@@ -2187,28 +2216,28 @@ void dscPrintModule_Keys() {
 
 void dscPrintPanelBinary(bool printSpaces) {
   for (byte dscPanelByte = 0; dscPanelByte < dscPanelByteCount; dscPanelByte++) {
-    if (dscPanelByte == 1) printf("%d", dscPanelData[dscPanelByte]);  // Prints the stop bit
+    if (dscPanelByte == 1) dscPrintf("%d", dscPanelData[dscPanelByte]);  // Prints the stop bit
     else {
       for (byte mask = 0x80; mask; mask >>= 1) {
-        if (mask & dscPanelData[dscPanelByte]) printf("1");
-        else printf("0");
+        if (mask & dscPanelData[dscPanelByte]) dscPrintf("1");
+        else dscPrintf("0");
       }
     }
-    if (printSpaces && (dscPanelByte != dscPanelByteCount - 1)) printf(" ");
+    if (printSpaces && (dscPanelByte != dscPanelByteCount - 1)) dscPrintf(" ");
   }
 }
 
 
 void dscPrintModuleBinary(bool printSpaces) {
   for (byte dscModuleByte = 0; dscModuleByte < dscModuleByteCount; dscModuleByte++) {
-    if (dscModuleByte == 1) printf("%d", dscModuleData[dscModuleByte]);  // Prints the stop bit
+    if (dscModuleByte == 1) dscPrintf("%d", dscModuleData[dscModuleByte]);  // Prints the stop bit
     else {
       for (byte mask = 0x80; mask; mask >>= 1) {
-        if (mask & dscModuleData[dscModuleByte]) printf("1");
-        else printf("0");
+        if (mask & dscModuleData[dscModuleByte]) dscPrintf("1");
+        else dscPrintf("0");
       }
     }
-    if (printSpaces && (dscModuleByte != dscModuleByteCount - 1)) printf(" ");
+    if (printSpaces && (dscModuleByte != dscModuleByteCount - 1)) dscPrintf(" ");
   }
 }
 
@@ -2218,5 +2247,5 @@ void dscPrintModuleBinary(bool printSpaces) {
  */
 void dscPrintPanelCommand() {
   // Prints the hex value of command byte 0
-  printf("0x%02X", dscPanelData[0]);
+  dscPrintf("0x%02X", dscPanelData[0]);
 }
@@ -29,10 +29,10 @@ void dscResetStatus() {
   dscPowerChanged = true;
   dscBatteryChanged = true;
   for (byte partition = 0; partition < dscPartitions; partition++) {
-    dscReadyChanged[partition] = true;
-    dscArmedChanged[partition] = true;
-    dscAlarmChanged[partition] = true;
-    dscFireChanged[partition] = true;
+    bitSet(dscPartitionChanged[partition], DSC_STATUS_READY);
+    bitSet(dscPartitionChanged[partition], DSC_STATUS_ARMED);
+    bitSet(dscPartitionChanged[partition], DSC_STATUS_ALARM);
+    bitSet(dscPartitionChanged[partition], DSC_STATUS_FIRE);
   }
   dscOpenZonesStatusChanged = true;
   dscAlarmZonesStatusChanged = true;
@@ -43,40 +43,75 @@ void dscResetStatus() {
 }
 
 
-// Sets the panel time
-void dscSetTime(unsigned int dscYear, byte dscMonth, byte dscDay, byte dscHour, byte dscMinute, const char* dscAccessCode) {
-  if (!dscReady[0]) return;  // Skips if partition 1 is not ready
-  if (dscHour > 23 || dscMinute > 59 || dscMonth > 12 || dscDay > 31 || dscYear > 2099 || (dscYear > 99 && dscYear < 1900)) return;  // Skips if input date/time is invalid
-  static char timeEntry[21];
-  strcpy(timeEntry, "*6");
-  strcat(timeEntry, dscAccessCode);
-  strcat(timeEntry, "1");
-
-  char timeChar[3];
-  if (dscHour < 10) strcat(timeEntry, "0");
-  itoa(dscHour, timeChar, 10);
-  strcat(timeEntry, timeChar);
-
-  if (dscMinute < 10) strcat(timeEntry, "0");
-  itoa(dscMinute, timeChar, 10);
-  strcat(timeEntry, timeChar);
-
-  if (dscMonth < 10) strcat(timeEntry, "0");
-  itoa(dscMonth, timeChar, 10);
-  strcat(timeEntry, timeChar);
-
-  if (dscDay < 10) strcat(timeEntry, "0");
-  itoa(dscDay, timeChar, 10);
-  strcat(timeEntry, timeChar);
-
-  if (dscYear >= 2000) dscYear -= 2000;
-  else if (dscYear >= 1900) dscYear -= 1900;
-  if (dscYear < 10) strcat(timeEntry, "0");
-  itoa(dscYear, timeChar, 10);
-  strcat(timeEntry, timeChar);
-
-  strcat(timeEntry, "#");
-  dscWriteKeys(timeEntry);
+// Copies the current status - dscPanelLoop() holds dscStatusMutex while processing a command, so the snapshot never
+// contains a partially processed command
+void dscSnapshot(dscStatusSnapshot *snapshot) {
+  xSemaphoreTake(dscStatusMutex, portMAX_DELAY);
+  for (byte partition = 0; partition < dscPartitions; partition++) {
+    snapshot->partition[partition] = dscPartitionStatus[partition];
+    snapshot->exitState[partition] = dscExitState[partition];
+    snapshot->accessCode[partition] = dscAccessCode[partition];
+  }
+  for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
+    snapshot->openZones[zoneGroup] = dscOpenZones[zoneGroup];
+    snapshot->alarmZones[zoneGroup] = dscAlarmZones[zoneGroup];
+  }
+  snapshot->system = 0;
+  bitWrite(snapshot->system, DSC_STATUS_KEYBUS, dscKeybusConnected);
+  bitWrite(snapshot->system, DSC_STATUS_TROUBLE, dscTrouble);
+  bitWrite(snapshot->system, DSC_STATUS_POWER_TROUBLE, dscPowerTrouble);
+  bitWrite(snapshot->system, DSC_STATUS_BATTERY_TROUBLE, dscBatteryTrouble);
+  bitWrite(snapshot->system, DSC_STATUS_KEYPAD_FIRE, dscKeypadFireAlarm);
+  bitWrite(snapshot->system, DSC_STATUS_KEYPAD_AUX, dscKeypadAuxAlarm);
+  bitWrite(snapshot->system, DSC_STATUS_KEYPAD_PANIC, dscKeypadPanicAlarm);
+  xSemaphoreGive(dscStatusMutex);
+}
+
+
+// Compares two snapshots and returns the status that changed as dscEventBit(DSC_EVENT_*) flags
+uint32_t dscDiff(const dscStatusSnapshot *previous, const dscStatusSnapshot *current) {
+  static const byte partitionEvents[] = {
+    [DSC_STATUS_READY] = DSC_EVENT_READY,
+    [DSC_STATUS_ARMED] = DSC_EVENT_ARMED,
+    [DSC_STATUS_ARMED_AWAY] = DSC_EVENT_ARMED,
+    [DSC_STATUS_ARMED_STAY] = DSC_EVENT_ARMED,
+    [DSC_STATUS_NO_ENTRY_DELAY] = DSC_EVENT_ARMED,
+    [DSC_STATUS_ALARM] = DSC_EVENT_ALARM,
+    [DSC_STATUS_EXIT_DELAY] = DSC_EVENT_EXIT_DELAY,
+    [DSC_STATUS_ENTRY_DELAY] = DSC_EVENT_ENTRY_DELAY,
+    [DSC_STATUS_FIRE] = DSC_EVENT_FIRE,
+  };
+  static const byte systemEvents[] = {
+    [DSC_STATUS_KEYBUS] = DSC_EVENT_KEYBUS,
+    [DSC_STATUS_TROUBLE] = DSC_EVENT_TROUBLE,
+    [DSC_STATUS_POWER_TROUBLE] = DSC_EVENT_POWER_TROUBLE,
+    [DSC_STATUS_BATTERY_TROUBLE] = DSC_EVENT_BATTERY_TROUBLE,
+    [DSC_STATUS_KEYPAD_FIRE] = DSC_EVENT_KEYPAD_FIRE,
+    [DSC_STATUS_KEYPAD_AUX] = DSC_EVENT_KEYPAD_AUX,
+    [DSC_STATUS_KEYPAD_PANIC] = DSC_EVENT_KEYPAD_PANIC,
+  };
+
+  uint32_t changes = 0;
+  uint16_t partitionChanges = 0;
+  for (byte partition = 0; partition < dscPartitions; partition++) {
+    partitionChanges |= previous->partition[partition] ^ current->partition[partition];
+    if (previous->exitState[partition] != current->exitState[partition]) changes |= dscEventBit(DSC_EVENT_EXIT_STATE);
+    if (previous->accessCode[partition] != current->accessCode[partition]) changes |= dscEventBit(DSC_EVENT_ACCESS_CODE);
+  }
+  for (byte statusBit = 0; statusBit < sizeof(partitionEvents); statusBit++) {
+    if (bitRead(partitionChanges, statusBit)) changes |= dscEventBit(partitionEvents[statusBit]);
+  }
+
+  for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
+    if (previous->openZones[zoneGroup] != current->openZones[zoneGroup]) changes |= dscEventBit(DSC_EVENT_ZONE_OPEN);
+    if (previous->alarmZones[zoneGroup] != current->alarmZones[zoneGroup]) changes |= dscEventBit(DSC_EVENT_ZONE_ALARM);
+  }
+
+  byte systemChanges = previous->system ^ current->system;
+  for (byte statusBit = 0; statusBit < sizeof(systemEvents); statusBit++) {
+    if (bitRead(systemChanges, statusBit)) changes |= dscEventBit(systemEvents[statusBit]);
+  }
+  return changes;
 }
 
 
@@ -89,6 +124,7 @@ void dscProcessPanelStatus() {
   if (dscTrouble != dscPreviousTrouble && (dscPanelData[3] < 0x05 || dscPanelData[3] == 0xC7)) {  // Ignores trouble light status in intermittent states
     dscPreviousTrouble = dscTrouble;
     dscTroubleChanged = true;
+    dscEmitEvent(DSC_EVENT_TROUBLE, 0, dscTrouble);
     if (!dscPauseStatus) dscStatusChanged = true;
   }
 
@@ -131,11 +167,12 @@ void dscProcessPanelStatus() {
     }
 
     // Fire status
-    if (bitRead(dscPanelData[statusByte],6)) dscFire[partitionIndex] = true;
-    else dscFire[partitionIndex] = false;
-    if (dscFire[partitionIndex] != dscPreviousFire[partitionIndex] && dscPanelData[messageByte] < 0x12) {  // Ignores fire light status in intermittent states
-      dscPreviousFire[partitionIndex] = dscFire[partitionIndex];
-      dscFireChanged[partitionIndex] = true;
+    if (bitRead(dscPanelData[statusByte],6)) bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_FIRE);
+    else bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_FIRE);
+    if (dscFire(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_FIRE) && dscPanelData[messageByte] < 0x12) {  // Ignores fire light status in intermittent states
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_FIRE, dscFire(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_FIRE);
+      dscEmitEvent(DSC_EVENT_FIRE, partitionIndex, dscFire(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
@@ -146,26 +183,29 @@ void dscProcessPanelStatus() {
       // Ready
       case 0x01:         // Partition ready
       case 0x02: {       // Stay/away zones open
-        dscReady[partitionIndex] = true;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscEntryDelay[partitionIndex] = false;
-        if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-          dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-          dscEntryDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+        if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+          dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscArmedStay[partitionIndex] = false;
-        dscArmedAway[partitionIndex] = false;
-        dscArmed[partitionIndex] = false;
-        if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex]) {
-          dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-          dscArmedChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+        if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+          dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -173,17 +213,19 @@ void dscProcessPanelStatus() {
 
       // Zones open
       case 0x03: {
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscEntryDelay[partitionIndex] = false;
-        if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-          dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-          dscEntryDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+        if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+          dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -193,44 +235,48 @@ void dscProcessPanelStatus() {
       case 0x04:         // Armed stay
       case 0x05: {       // Armed away
         if (dscPanelData[messageByte] == 0x04) {
-          dscArmedStay[partitionIndex] = true;
-          dscArmedAway[partitionIndex] = false;
+          bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+          bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
         }
         else {
-          dscArmedStay[partitionIndex] = false;
-          dscArmedAway[partitionIndex] = true;
+          bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+          bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
         }
 
         dscWriteArm[partitionIndex] = false;
 
-        dscArmed[partitionIndex] = true;
-        if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex] || dscArmedStay[partitionIndex] != dscPreviousArmedStay[partitionIndex]) {
-          dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-          dscPreviousArmedStay[partitionIndex] = dscArmedStay[partitionIndex];
-          dscArmedChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+        if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED) || dscArmedStay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY, dscArmedStay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+          dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscExitDelay[partitionIndex] = false;
-        if (dscExitDelay[partitionIndex] != dscPreviousExitDelay[partitionIndex]) {
-          dscPreviousExitDelay[partitionIndex] = dscExitDelay[partitionIndex];
-          dscExitDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY);
+        if (dscExitDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY, dscExitDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+          dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
         dscExitState[partitionIndex] = 0;
 
-        dscEntryDelay[partitionIndex] = false;
-        if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-          dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-          dscEntryDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+        if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+          dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -241,10 +287,11 @@ void dscProcessPanelStatus() {
         dscWriteArm[partitionIndex] = false;
         dscAccessCodePrompt = false;
 
-        dscExitDelay[partitionIndex] = true;
-        if (dscExitDelay[partitionIndex] != dscPreviousExitDelay[partitionIndex]) {
-          dscPreviousExitDelay[partitionIndex] = dscExitDelay[partitionIndex];
-          dscExitDelayChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY);
+        if (dscExitDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY, dscExitDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+          dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
@@ -253,16 +300,19 @@ void dscProcessPanelStatus() {
           else dscExitState[partitionIndex] = DSC_EXIT_AWAY;
           if (dscExitState[partitionIndex] != dscPreviousExitState[partitionIndex]) {
             dscPreviousExitState[partitionIndex] = dscExitState[partitionIndex];
-            dscExitDelayChanged[partitionIndex] = true;
-            dscExitStateChanged[partitionIndex] = true;
+            bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+            dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
+            bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_STATE);
+            dscEmitEvent(DSC_EVENT_EXIT_STATE, partitionIndex, dscExitState[partitionIndex]);
             if (!dscPauseStatus) dscStatusChanged = true;
           }
         }
 
-        dscReady[partitionIndex] = true;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -270,10 +320,11 @@ void dscProcessPanelStatus() {
 
       // Arming with no entry delay
       case 0x09: {
-        dscReady[partitionIndex] = true;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
@@ -283,17 +334,19 @@ void dscProcessPanelStatus() {
 
       // Entry delay in progress
       case 0x0C: {
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscEntryDelay[partitionIndex] = true;
-        if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-          dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-          dscEntryDelayChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+        if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+          dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -301,24 +354,27 @@ void dscProcessPanelStatus() {
 
       // Partition in alarm
       case 0x11: {
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscEntryDelay[partitionIndex] = false;
-        if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-          dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-          dscEntryDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+        if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+          dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscAlarm[partitionIndex] = true;
-        if (dscAlarm[partitionIndex] != dscPreviousAlarm[partitionIndex]) {
-          dscPreviousAlarm[partitionIndex] = dscAlarm[partitionIndex];
-          dscAlarmChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ALARM);
+        if (dscAlarm(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM, dscAlarm(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ALARM);
+          dscEmitEvent(DSC_EVENT_ALARM, partitionIndex, dscAlarm(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -326,23 +382,25 @@ void dscProcessPanelStatus() {
 
       // Partition armed with no entry delay
       case 0x16: {
-        dscNoEntryDelay[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_NO_ENTRY_DELAY);
 
         // Sets an armed mode if not already set, used if interface is initialized while the panel is armed
-        if (!dscArmedStay[partitionIndex] && !dscArmedAway[partitionIndex]) dscArmedStay[partitionIndex] = true;
-
-        dscArmed[partitionIndex] = true;
-        if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex]) {
-          dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-          dscPreviousArmedStay[partitionIndex] = dscArmedStay[partitionIndex];
-          dscArmedChanged[partitionIndex] = true;
+        if (!dscArmedStay(partitionIndex) && !dscArmedAway(partitionIndex)) bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+        if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY, dscArmedStay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+          dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -350,26 +408,29 @@ void dscProcessPanelStatus() {
 
       // Partition disarmed
       case 0x3E: {
-        dscExitDelay[partitionIndex] = false;
-        if (dscExitDelay[partitionIndex] != dscPreviousExitDelay[partitionIndex]) {
-          dscPreviousExitDelay[partitionIndex] = dscExitDelay[partitionIndex];
-          dscExitDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY);
+        if (dscExitDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY, dscExitDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+          dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
         dscExitState[partitionIndex] = 0;
 
-        dscEntryDelay[partitionIndex] = false;
-        if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-          dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-          dscEntryDelayChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+        if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+          dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscAlarm[partitionIndex] = false;
-        if (dscAlarm[partitionIndex] != dscPreviousAlarm[partitionIndex]) {
-          dscPreviousAlarm[partitionIndex] = dscAlarm[partitionIndex];
-          dscAlarmChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ALARM);
+        if (dscAlarm(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM, dscAlarm(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ALARM);
+          dscEmitEvent(DSC_EVENT_ALARM, partitionIndex, dscAlarm(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -377,11 +438,13 @@ void dscProcessPanelStatus() {
 
       // Invalid access code
       case 0x8F: {
-        if (!dscArmed[partitionIndex]) {
-          dscReady[partitionIndex] = true;
-          if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-            dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-            dscReadyChanged[partitionIndex] = true;
+        dscCommandRejected(partitionIndex);
+        if (!dscArmed(partitionIndex)) {
+          bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+          if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+            bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+            bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+            dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
             if (!dscPauseStatus) dscStatusChanged = true;
           }
         }
@@ -390,13 +453,21 @@ void dscProcessPanelStatus() {
 
       // Enter * function code
       case 0x9E: {
+        #if dscWritePipeline
+        taskENTER_CRITICAL();
+        dscKeyFifo[partitionIndex].pending = false;  // Resets the flag that delays writing after '*' is pressed
+        dscKeyFifo[partitionIndex].asterisk = false;
+        taskEXIT_CRITICAL();
+        #else
         dscWroteAsterisk = false;  // Resets the flag that delays writing after '*' is pressed
         dscWriteAsterisk = false;
         dscPanelKeyPending = false;
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        #endif
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -404,25 +475,29 @@ void dscProcessPanelStatus() {
 
       // Enter access code
       case 0x9F: {
-        if (dscWriteArm[partitionIndex]) {  // Ensures access codes are only sent when an arm command is sent through this interface
+        // Ensures access codes are only sent when an arm command is sent through this interface - dscArm() writes the
+        // access code itself
+        if (dscWriteArm[partitionIndex] && !dscCommandPrompt(partitionIndex)) {
           dscAccessCodePrompt = true;
           if (!dscPauseStatus) dscStatusChanged = true;
         }
 
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
       }
 
       default: {
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         break;
@@ -434,42 +509,43 @@ void dscProcessPanelStatus() {
 
 // Panel status and zones 1-8 status
 void dscProcessPanel_0x27() {
-  if (!dscValidCRC()) return;
-
   for (byte partitionIndex = 0; partitionIndex < 2; partitionIndex++) {
     byte messageByte = (partitionIndex * 2) + 3;
 
     // Messages
     if (dscPanelData[messageByte] == 0x04 || dscPanelData[messageByte] == 0x05) {
 
-      dscReady[partitionIndex] = false;
-      if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-        dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-        dscReadyChanged[partitionIndex] = true;
+      bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+      if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+        dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
       }
 
       if (dscPanelData[messageByte] == 0x04) {
-        dscArmedStay[partitionIndex] = true;
-        dscArmedAway[partitionIndex] = false;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
       }
       else if (dscPanelData[messageByte] == 0x05) {
-        dscArmedStay[partitionIndex] = false;
-        dscArmedAway[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
       }
 
-      dscArmed[partitionIndex] = true;
-      if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex] || dscArmedStay[partitionIndex] != dscPreviousArmedStay[partitionIndex]) {
-        dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-        dscPreviousArmedStay[partitionIndex] = dscArmedStay[partitionIndex];
-        dscArmedChanged[partitionIndex] = true;
+      bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+      if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED) || dscArmedStay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY)) {
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY, dscArmedStay(partitionIndex));
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+        dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
       }
 
-      dscExitDelay[partitionIndex] = false;
-      if (dscExitDelay[partitionIndex] != dscPreviousExitDelay[partitionIndex]) {
-        dscPreviousExitDelay[partitionIndex] = dscExitDelay[partitionIndex];
-        dscExitDelayChanged[partitionIndex] = true;
+      bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY);
+      if (dscExitDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY)) {
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY, dscExitDelay(partitionIndex));
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+        dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
       }
 
@@ -478,32 +554,35 @@ void dscProcessPanel_0x27() {
 
     // Armed with no entry delay
     else if (dscPanelData[messageByte] == 0x16) {
-      dscNoEntryDelay[partitionIndex] = true;
+      bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_NO_ENTRY_DELAY);
 
       // Sets an armed mode if not already set, used if interface is initialized while the panel is armed
-      if (!dscArmedStay[partitionIndex] && !dscArmedAway[partitionIndex]) dscArmedStay[partitionIndex] = true;
-
-      dscArmed[partitionIndex] = true;
-      if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex]) {
-        dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-        dscPreviousArmedStay[partitionIndex] = dscArmedStay[partitionIndex];
-        dscArmedChanged[partitionIndex] = true;
+      if (!dscArmedStay(partitionIndex) && !dscArmedAway(partitionIndex)) bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+
+      bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+      if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED)) {
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY, dscArmedStay(partitionIndex));
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+        dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
       }
 
-      dscExitDelay[partitionIndex] = false;
-      if (dscExitDelay[partitionIndex] != dscPreviousExitDelay[partitionIndex]) {
-        dscPreviousExitDelay[partitionIndex] = dscExitDelay[partitionIndex];
-        dscExitDelayChanged[partitionIndex] = true;
+      bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY);
+      if (dscExitDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY)) {
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY, dscExitDelay(partitionIndex));
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+        dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
       }
 
       dscExitState[partitionIndex] = 0;
 
-      dscReady[partitionIndex] = false;
-      if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-        dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-        dscReadyChanged[partitionIndex] = true;
+      bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+      if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+        bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+        dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
       }
     }
@@ -520,6 +599,7 @@ void dscProcessPanel_0x27() {
     for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
       if (bitRead(zonesChanged, zoneBit)) {
         bitWrite(dscOpenZonesChanged[0], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit, bitRead(dscOpenZones[0], zoneBit));
         if (bitRead(dscPanelData[6], zoneBit)) bitWrite(dscOpenZones[0], zoneBit, 1);
         else bitWrite(dscOpenZones[0], zoneBit, 0);
       }
@@ -528,11 +608,9 @@ void dscProcessPanel_0x27() {
 }
 
 
+#if dscZones > 1
 // Zones 9-16 status
 void dscProcessPanel_0x2D() {
-  if (!dscValidCRC()) return;
-  if (dscZones < 2) return;
-
   // Open zones 9-16 status is stored in dscOpenZones[1] and dscOpenZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
   dscOpenZones[1] = dscPanelData[6];
   byte zonesChanged = dscOpenZones[1] ^ dscPreviousOpenZones[1];
@@ -544,19 +622,19 @@ void dscProcessPanel_0x2D() {
     for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
       if (bitRead(zonesChanged, zoneBit)) {
         bitWrite(dscOpenZonesChanged[1], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 8, bitRead(dscOpenZones[1], zoneBit));
         if (bitRead(dscPanelData[6], zoneBit)) bitWrite(dscOpenZones[1], zoneBit, 1);
         else bitWrite(dscOpenZones[1], zoneBit, 0);
       }
     }
   }
 }
+#endif
 
 
+#if dscZones > 2
 // Zones 17-24 status
 void dscProcessPanel_0x34() {
-  if (!dscValidCRC()) return;
-  if (dscZones < 3) return;
-
   // Open zones 17-24 status is stored in dscOpenZones[2] and dscOpenZonesChanged[2]: Bit 0 = Zone 17 ... Bit 7 = Zone 24
   dscOpenZones[2] = dscPanelData[6];
   byte zonesChanged = dscOpenZones[2] ^ dscPreviousOpenZones[2];
@@ -568,19 +646,19 @@ void dscProcessPanel_0x34() {
     for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
       if (bitRead(zonesChanged, zoneBit)) {
         bitWrite(dscOpenZonesChanged[2], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 16, bitRead(dscOpenZones[2], zoneBit));
         if (bitRead(dscPanelData[6], zoneBit)) bitWrite(dscOpenZones[2], zoneBit, 1);
         else bitWrite(dscOpenZones[2], zoneBit, 0);
       }
     }
   }
 }
+#endif
 
 
+#if dscZones > 3
 // Zones 25-32 status
 void dscProcessPanel_0x3E() {
-  if (!dscValidCRC()) return;
-  if (dscZones < 4) return;
-
   // Open zones 25-32 status is stored in dscOpenZones[3] and dscOpenZonesChanged[3]: Bit 0 = Zone 25 ... Bit 7 = Zone 32
   dscOpenZones[3] = dscPanelData[6];
   byte zonesChanged = dscOpenZones[3] ^ dscPreviousOpenZones[3];
@@ -592,17 +670,17 @@ void dscProcessPanel_0x3E() {
     for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
       if (bitRead(zonesChanged, zoneBit)) {
         bitWrite(dscOpenZonesChanged[3], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 24, bitRead(dscOpenZones[3], zoneBit));
         if (bitRead(dscPanelData[6], zoneBit)) bitWrite(dscOpenZones[3], zoneBit, 1);
         else bitWrite(dscOpenZones[3], zoneBit, 0);
       }
     }
   }
 }
+#endif
 
 
 void dscProcessPanel_0xA5() {
-  if (!dscValidCRC()) return;
-
   byte dscYear3 = dscPanelData[2] >> 4;
   byte dscYear4 = dscPanelData[2] & 0x0F;
   dscYear = (dscYear3 * 10) + dscYear4;
@@ -619,6 +697,7 @@ void dscProcessPanel_0xA5() {
   if (dscPanelData[6] == 0 && dscPanelData[7] == 0) {
     dscStatusChanged = true;
     dscTimestampChanged = true;
+    dscEmitEvent(DSC_EVENT_TIMESTAMP, 0, 0);
     return;
   }
 
@@ -630,10 +709,8 @@ void dscProcessPanel_0xA5() {
 }
 
 
+#if dscPartitions > 2
 void dscProcessPanel_0xEB() {
-  if (!dscValidCRC()) return;
-  if (dscPartitions < 3) return;
-
   byte dscYear3 = dscPanelData[3] >> 4;
   byte dscYear4 = dscPanelData[3] & 0x0F;
   dscYear = (dscYear3 * 10) + dscYear4;
@@ -665,6 +742,7 @@ void dscProcessPanel_0xEB() {
     case 0x04: dscProcessPanelStatus4(partition, 8); break;
   }
 }
+#endif
 
 
 void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
@@ -676,6 +754,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       // Keypad Fire alarm
       case 0x4E: {
         dscKeypadFireAlarm = true;
+        dscEmitEvent(DSC_EVENT_KEYPAD_FIRE, 0, true);
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
@@ -683,6 +762,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       // Keypad Aux alarm
       case 0x4F: {
         dscKeypadAuxAlarm = true;
+        dscEmitEvent(DSC_EVENT_KEYPAD_AUX, 0, true);
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
@@ -690,6 +770,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       // Keypad Panic alarm
       case 0x50: {
         dscKeypadPanicAlarm = true;
+        dscEmitEvent(DSC_EVENT_KEYPAD_PANIC, 0, true);
         if (!dscPauseStatus) dscStatusChanged =true;
         return;
       }
@@ -698,6 +779,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       case 0xE7: {
         dscBatteryTrouble = true;
         dscBatteryChanged = true;
+        dscEmitEvent(DSC_EVENT_BATTERY_TROUBLE, 0, dscBatteryTrouble);
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
@@ -706,6 +788,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       case 0xE8: {
         dscPowerTrouble = true;
         dscPowerChanged = true;
+        dscEmitEvent(DSC_EVENT_POWER_TROUBLE, 0, dscPowerTrouble);
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
@@ -714,6 +797,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       case 0xEF: {
         dscBatteryTrouble = false;
         dscBatteryChanged = true;
+        dscEmitEvent(DSC_EVENT_BATTERY_TROUBLE, 0, dscBatteryTrouble);
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
@@ -722,6 +806,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       case 0xF0: {
         dscPowerTrouble = false;
         dscPowerChanged = true;
+        dscEmitEvent(DSC_EVENT_POWER_TROUBLE, 0, dscPowerTrouble);
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
@@ -738,28 +823,31 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
       dscPanelData[dscPanelByte] == 0xE6 ||                                    // Disarmed special: keyswitch/wireless key/DLS
       (dscPanelData[dscPanelByte] >= 0xC0 && dscPanelData[dscPanelByte] <= 0xE4)) {  // Disarmed by access code
 
-    dscNoEntryDelay[partitionIndex] = false;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_NO_ENTRY_DELAY);
 
-    dscArmedAway[partitionIndex] = false;
-    dscArmedStay[partitionIndex] = false;
-    dscArmed[partitionIndex] = false;
-    if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex]) {
-      dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-      dscArmedChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+    if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+      dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
-    dscAlarm[partitionIndex] = false;
-    if (dscAlarm[partitionIndex] != dscPreviousAlarm[partitionIndex]) {
-      dscPreviousAlarm[partitionIndex] = dscAlarm[partitionIndex];
-      dscAlarmChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ALARM);
+    if (dscAlarm(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM, dscAlarm(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ALARM);
+      dscEmitEvent(DSC_EVENT_ALARM, partitionIndex, dscAlarm(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
-    dscEntryDelay[partitionIndex] = false;
-    if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-      dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-      dscEntryDelayChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+    if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+      dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
     return;
@@ -767,10 +855,11 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
 
   // Partition in alarm
   if (dscPanelData[dscPanelByte] == 0x4B) {
-    dscAlarm[partitionIndex] = true;
-    if (dscAlarm[partitionIndex] != dscPreviousAlarm[partitionIndex]) {
-      dscPreviousAlarm[partitionIndex] = dscAlarm[partitionIndex];
-      dscAlarmChanged[partitionIndex] = true;
+    bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ALARM);
+    if (dscAlarm(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM, dscAlarm(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ALARM);
+      dscEmitEvent(DSC_EVENT_ALARM, partitionIndex, dscAlarm(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
     return;
@@ -783,17 +872,19 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
   //   ...
   //   dscAlarmZones[7] and dscAlarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
   if (dscPanelData[dscPanelByte] >= 0x09 && dscPanelData[dscPanelByte] <= 0x28) {
-    dscAlarm[partitionIndex] = true;
-    if (dscAlarm[partitionIndex] != dscPreviousAlarm[partitionIndex]) {
-      dscPreviousAlarm[partitionIndex] = dscAlarm[partitionIndex];
-      dscAlarmChanged[partitionIndex] = true;
+    bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ALARM);
+    if (dscAlarm(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM, dscAlarm(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ALARM);
+      dscEmitEvent(DSC_EVENT_ALARM, partitionIndex, dscAlarm(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
-    dscEntryDelay[partitionIndex] = false;
-    if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-      dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-      dscEntryDelayChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+    if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+      dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
@@ -806,6 +897,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[0], zoneCount) != 1) {
             bitWrite(dscPreviousAlarmZones[0], zoneCount, 1);
             bitWrite(dscAlarmZonesChanged[0], zoneCount, 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[0], zoneCount));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -815,6 +907,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[1], (zoneCount - 8)) != 1) {
             bitWrite(dscPreviousAlarmZones[1], (zoneCount - 8), 1);
             bitWrite(dscAlarmZonesChanged[1], (zoneCount - 8), 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[1], (zoneCount - 8)));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -824,6 +917,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[2], (zoneCount - 16)) != 1) {
             bitWrite(dscPreviousAlarmZones[2], (zoneCount - 16), 1);
             bitWrite(dscAlarmZonesChanged[2], (zoneCount - 16), 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[2], (zoneCount - 16)));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -833,6 +927,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[3], (zoneCount - 24)) != 1) {
             bitWrite(dscPreviousAlarmZones[3], (zoneCount - 24), 1);
             bitWrite(dscAlarmZonesChanged[3], (zoneCount - 24), 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[3], (zoneCount - 24)));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -859,6 +954,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[0], zoneCount) != 0) {
             bitWrite(dscPreviousAlarmZones[0], zoneCount, 0);
             bitWrite(dscAlarmZonesChanged[0], zoneCount, 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[0], zoneCount));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -868,6 +964,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[1], (zoneCount - 8)) != 0) {
             bitWrite(dscPreviousAlarmZones[1], (zoneCount - 8), 0);
             bitWrite(dscAlarmZonesChanged[1], (zoneCount - 8), 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[1], (zoneCount - 8)));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -877,6 +974,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[2], (zoneCount - 16)) != 0) {
             bitWrite(dscPreviousAlarmZones[2], (zoneCount - 16), 0);
             bitWrite(dscAlarmZonesChanged[2], (zoneCount - 16), 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[2], (zoneCount - 16)));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -886,6 +984,7 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
           if (bitRead(dscPreviousAlarmZones[3], (zoneCount - 24)) != 0) {
             bitWrite(dscPreviousAlarmZones[3], (zoneCount - 24), 0);
             bitWrite(dscAlarmZonesChanged[3], (zoneCount - 24), 1);
+            dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount, bitRead(dscAlarmZones[3], (zoneCount - 24)));
             dscAlarmZonesStatusChanged = true;
             if (!dscPauseStatus) dscStatusChanged = true;
           }
@@ -901,7 +1000,8 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
     if (dscAccessCode[partitionIndex] >= 35) dscAccessCode[partitionIndex] += 5;
     if (dscAccessCode[partitionIndex] != dscPreviousAccessCode[partitionIndex]) {
       dscPreviousAccessCode[partitionIndex] = dscAccessCode[partitionIndex];
-      dscAccessCodeChanged[partitionIndex] = true;
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ACCESS_CODE);
+      dscEmitEvent(DSC_EVENT_ACCESS_CODE, partitionIndex, dscAccessCode[partitionIndex]);
       if (!dscPauseStatus) dscStatusChanged = true;
     }
     return;
@@ -913,7 +1013,8 @@ void dscProcessPanelStatus0(byte partition, byte dscPanelByte) {
     if (dscAccessCode[partitionIndex] >= 35) dscAccessCode[partitionIndex] += 5;
     if (dscAccessCode[partitionIndex] != dscPreviousAccessCode[partitionIndex]) {
       dscPreviousAccessCode[partitionIndex] = dscAccessCode[partitionIndex];
-      dscAccessCodeChanged[partitionIndex] = true;
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ACCESS_CODE);
+      dscEmitEvent(DSC_EVENT_ACCESS_CODE, partitionIndex, dscAccessCode[partitionIndex]);
       if (!dscPauseStatus) dscStatusChanged = true;
     }
     return;
@@ -928,35 +1029,38 @@ void dscProcessPanelStatus2(byte partition, byte dscPanelByte) {
   // Armed: stay and Armed: away
   if (dscPanelData[dscPanelByte] == 0x9A || dscPanelData[dscPanelByte] == 0x9B) {
     if (dscPanelData[dscPanelByte] == 0x9A) {
-      dscArmedStay[partitionIndex] = true;
-      dscArmedAway[partitionIndex] = false;
+      bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+      bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
     }
     else if (dscPanelData[dscPanelByte] == 0x9B) {
-      dscArmedStay[partitionIndex] = false;
-      dscArmedAway[partitionIndex] = true;
+      bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+      bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
     }
 
-    dscArmed[partitionIndex] = true;
-    if (dscArmed[partitionIndex] != dscPreviousArmed[partitionIndex] || dscArmedStay[partitionIndex] != dscPreviousArmedStay[partitionIndex]) {
-      dscPreviousArmed[partitionIndex] = dscArmed[partitionIndex];
-      dscPreviousArmedStay[partitionIndex] = dscArmedStay[partitionIndex];
-      dscArmedChanged[partitionIndex] = true;
+    bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+    if (dscArmed(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED) || dscArmedStay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED, dscArmed(partitionIndex));
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY, dscArmedStay(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+      dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
-    dscExitDelay[partitionIndex] = false;
-    if (dscExitDelay[partitionIndex] != dscPreviousExitDelay[partitionIndex]) {
-      dscPreviousExitDelay[partitionIndex] = dscExitDelay[partitionIndex];
-      dscExitDelayChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY);
+    if (dscExitDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_EXIT_DELAY, dscExitDelay(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_EXIT_DELAY);
+      dscEmitEvent(DSC_EVENT_EXIT_DELAY, partitionIndex, dscExitDelay(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
     dscExitState[partitionIndex] = 0;
 
-    dscReady[partitionIndex] = false;
-    if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-      dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-      dscReadyChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+    if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+      dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
     return;
@@ -965,20 +1069,22 @@ void dscProcessPanelStatus2(byte partition, byte dscPanelByte) {
   if (dscPanelData[dscPanelByte] == 0xA5) {
     switch (dscPanelData[dscPanelByte]) {
       case 0x99: {        // Activate stay/away zones
-        dscArmed[partitionIndex] = true;
-        dscArmedAway[partitionIndex] = true;
-        dscArmedStay[partitionIndex] = false;
-        dscArmedChanged[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED);
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_AWAY);
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ARMED_STAY);
+        bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ARMED);
+        dscEmitEvent(DSC_EVENT_ARMED, partitionIndex, dscArmedState(partitionIndex));
         if (!dscPauseStatus) dscStatusChanged = true;
         return;
       }
       case 0x9C: {        // Armed with no entry delay
-        dscNoEntryDelay[partitionIndex] = true;
+        bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_NO_ENTRY_DELAY);
 
-        dscReady[partitionIndex] = false;
-        if (dscReady[partitionIndex] != dscPreviousReady[partitionIndex]) {
-          dscPreviousReady[partitionIndex] = dscReady[partitionIndex];
-          dscReadyChanged[partitionIndex] = true;
+        bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_READY);
+        if (dscReady(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY)) {
+          bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_READY, dscReady(partitionIndex));
+          bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_READY);
+          dscEmitEvent(DSC_EVENT_READY, partitionIndex, dscReady(partitionIndex));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         return;
@@ -988,6 +1094,7 @@ void dscProcessPanelStatus2(byte partition, byte dscPanelByte) {
 }
 
 
+#if dscPartitions > 2
 void dscProcessPanelStatus4(byte partition, byte dscPanelByte) {
   if (partition == 0 || partition > dscPartitions) return;
   byte partitionIndex = partition - 1;
@@ -1001,17 +1108,19 @@ void dscProcessPanelStatus4(byte partition, byte dscPanelByte) {
   if (dscPanelData[dscPanelByte] <= 0x1F) {
     dscAlarmZonesStatusChanged = true;
 
-    dscAlarm[partitionIndex] = true;
-    if (dscAlarm[partitionIndex] != dscPreviousAlarm[partitionIndex]) {
-      dscPreviousAlarm[partitionIndex] = dscAlarm[partitionIndex];
-      dscAlarmChanged[partitionIndex] = true;
+    bitSet(dscPartitionStatus[partitionIndex], DSC_STATUS_ALARM);
+    if (dscAlarm(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ALARM, dscAlarm(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ALARM);
+      dscEmitEvent(DSC_EVENT_ALARM, partitionIndex, dscAlarm(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
-    dscEntryDelay[partitionIndex] = false;
-    if (dscEntryDelay[partitionIndex] != dscPreviousEntryDelay[partitionIndex]) {
-      dscPreviousEntryDelay[partitionIndex] = dscEntryDelay[partitionIndex];
-      dscEntryDelayChanged[partitionIndex] = true;
+    bitClear(dscPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+    if (dscEntryDelay(partitionIndex) != bitRead(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY)) {
+      bitWrite(dscPreviousPartitionStatus[partitionIndex], DSC_STATUS_ENTRY_DELAY, dscEntryDelay(partitionIndex));
+      bitSet(dscPartitionChanged[partitionIndex], DSC_STATUS_ENTRY_DELAY);
+      dscEmitEvent(DSC_EVENT_ENTRY_DELAY, partitionIndex, dscEntryDelay(partitionIndex));
       if (!dscPauseStatus) dscStatusChanged = true;
     }
 
@@ -1023,21 +1132,25 @@ void dscProcessPanelStatus4(byte partition, byte dscPanelByte) {
         if (zoneCount < 8) {
           bitWrite(dscAlarmZones[4], zoneCount, 1);
           bitWrite(dscAlarmZonesChanged[4], zoneCount, 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[4], zoneCount));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         else if (zoneCount >= 8 && zoneCount < 16) {
           bitWrite(dscAlarmZones[5], (zoneCount - 8), 1);
           bitWrite(dscAlarmZonesChanged[5], (zoneCount - 8), 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[5], (zoneCount - 8)));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         else if (zoneCount >= 16 && zoneCount < 24) {
           bitWrite(dscAlarmZones[6], (zoneCount - 16), 1);
           bitWrite(dscAlarmZonesChanged[6], (zoneCount - 16), 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[6], (zoneCount - 16)));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         else if (zoneCount >= 24 && zoneCount < 32) {
           bitWrite(dscAlarmZones[7], (zoneCount - 24), 1);
           bitWrite(dscAlarmZonesChanged[7], (zoneCount - 24), 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[7], (zoneCount - 24)));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
       }
@@ -1062,21 +1175,25 @@ void dscProcessPanelStatus4(byte partition, byte dscPanelByte) {
         if (zoneCount < 8) {
           bitWrite(dscAlarmZones[4], zoneCount, 0);
           bitWrite(dscAlarmZonesChanged[4], zoneCount, 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[4], zoneCount));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         else if (zoneCount >= 8 && zoneCount < 16) {
           bitWrite(dscAlarmZones[5], (zoneCount - 8), 0);
           bitWrite(dscAlarmZonesChanged[5], (zoneCount - 8), 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[5], (zoneCount - 8)));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         else if (zoneCount >= 16 && zoneCount < 24) {
           bitWrite(dscAlarmZones[6], (zoneCount - 16), 0);
           bitWrite(dscAlarmZonesChanged[6], (zoneCount - 16), 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[6], (zoneCount - 16)));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
         else if (zoneCount >= 24 && zoneCount < 32) {
           bitWrite(dscAlarmZones[7], (zoneCount - 24), 0);
           bitWrite(dscAlarmZonesChanged[7], (zoneCount - 24), 1);
+          dscEmitEvent(DSC_EVENT_ZONE_ALARM, zoneCount + 32, bitRead(dscAlarmZones[7], (zoneCount - 24)));
           if (!dscPauseStatus) dscStatusChanged = true;
         }
       }
@@ -1085,104 +1202,97 @@ void dscProcessPanelStatus4(byte partition, byte dscPanelByte) {
   }
 
 }
+#endif
 
 
+#if dscPartitions > 2 && dscZones > 4
 // Processes zones 33-64 status
-void dscProcessPanel_0xE6() {
-  if (!dscValidCRC()) return;
-
-  switch (dscPanelData[2]) {
-    case 0x09: dscProcessPanel_0xE6_0x09(); return;
-    case 0x0B: dscProcessPanel_0xE6_0x0B(); return;
-    case 0x0D: dscProcessPanel_0xE6_0x0D(); return;
-    case 0x0F: dscProcessPanel_0xE6_0x0F(); return;
-  }
-}
-
-
 // Open zones 33-40 status is stored in dscOpenZones[4] and dscOpenZonesChanged[4]: Bit 0 = Zone 33 ... Bit 7 = Zone 40
 void dscProcessPanel_0xE6_0x09() {
-  if (dscZones > 4) {
-    dscOpenZones[4] = dscPanelData[3];
-    byte zonesChanged = dscOpenZones[4] ^ dscPreviousOpenZones[4];
-    if (zonesChanged != 0) {
-      dscPreviousOpenZones[4] = dscOpenZones[4];
-      dscOpenZonesStatusChanged = true;
-      if (!dscPauseStatus) dscStatusChanged = true;
+  dscOpenZones[4] = dscPanelData[3];
+  byte zonesChanged = dscOpenZones[4] ^ dscPreviousOpenZones[4];
+  if (zonesChanged != 0) {
+    dscPreviousOpenZones[4] = dscOpenZones[4];
+    dscOpenZonesStatusChanged = true;
+    if (!dscPauseStatus) dscStatusChanged = true;
 
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(dscOpenZonesChanged[4], zoneBit, 1);
-          if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[4], zoneBit, 1);
-          else bitWrite(dscOpenZones[4], zoneBit, 0);
-        }
+    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
+      if (bitRead(zonesChanged, zoneBit)) {
+        bitWrite(dscOpenZonesChanged[4], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 32, bitRead(dscOpenZones[4], zoneBit));
+        if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[4], zoneBit, 1);
+        else bitWrite(dscOpenZones[4], zoneBit, 0);
       }
     }
   }
 }
+#endif
 
 
+#if dscPartitions > 2 && dscZones > 5
 // Open zones 41-48 status is stored in dscOpenZones[5] and dscOpenZonesChanged[5]: Bit 0 = Zone 41 ... Bit 7 = Zone 48
 void dscProcessPanel_0xE6_0x0B() {
-  if (dscZones > 5) {
-    dscOpenZones[5] = dscPanelData[3];
-    byte zonesChanged = dscOpenZones[5] ^ dscPreviousOpenZones[5];
-    if (zonesChanged != 0) {
-      dscPreviousOpenZones[5] = dscOpenZones[5];
-      dscOpenZonesStatusChanged = true;
-      if (!dscPauseStatus) dscStatusChanged = true;
+  dscOpenZones[5] = dscPanelData[3];
+  byte zonesChanged = dscOpenZones[5] ^ dscPreviousOpenZones[5];
+  if (zonesChanged != 0) {
+    dscPreviousOpenZones[5] = dscOpenZones[5];
+    dscOpenZonesStatusChanged = true;
+    if (!dscPauseStatus) dscStatusChanged = true;
 
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(dscOpenZonesChanged[5], zoneBit, 1);
-          if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[5], zoneBit, 1);
-          else bitWrite(dscOpenZones[5], zoneBit, 0);
-        }
+    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
+      if (bitRead(zonesChanged, zoneBit)) {
+        bitWrite(dscOpenZonesChanged[5], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 40, bitRead(dscOpenZones[5], zoneBit));
+        if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[5], zoneBit, 1);
+        else bitWrite(dscOpenZones[5], zoneBit, 0);
       }
     }
   }
 }
+#endif
 
 
+#if dscPartitions > 2 && dscZones > 6
 // Open zones 49-56 status is stored in dscOpenZones[6] and dscOpenZonesChanged[6]: Bit 0 = Zone 49 ... Bit 7 = Zone 56
 void dscProcessPanel_0xE6_0x0D() {
-  if (dscZones > 6) {
-    dscOpenZones[6] = dscPanelData[3];
-    byte zonesChanged = dscOpenZones[6] ^ dscPreviousOpenZones[6];
-    if (zonesChanged != 0) {
-      dscPreviousOpenZones[6] = dscOpenZones[6];
-      dscOpenZonesStatusChanged = true;
-      if (!dscPauseStatus) dscStatusChanged = true;
+  dscOpenZones[6] = dscPanelData[3];
+  byte zonesChanged = dscOpenZones[6] ^ dscPreviousOpenZones[6];
+  if (zonesChanged != 0) {
+    dscPreviousOpenZones[6] = dscOpenZones[6];
+    dscOpenZonesStatusChanged = true;
+    if (!dscPauseStatus) dscStatusChanged = true;
 
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(dscOpenZonesChanged[6], zoneBit, 1);
-          if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[6], zoneBit, 1);
-          else bitWrite(dscOpenZones[6], zoneBit, 0);
-        }
+    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
+      if (bitRead(zonesChanged, zoneBit)) {
+        bitWrite(dscOpenZonesChanged[6], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 48, bitRead(dscOpenZones[6], zoneBit));
+        if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[6], zoneBit, 1);
+        else bitWrite(dscOpenZones[6], zoneBit, 0);
       }
     }
   }
 }
+#endif
 
 
+#if dscPartitions > 2 && dscZones > 7
 // Open zones 57-64 status is stored in dscOpenZones[7] and dscOpenZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
 void dscProcessPanel_0xE6_0x0F() {
-  if (dscZones > 7) {
-    dscOpenZones[7] = dscPanelData[3];
-    byte zonesChanged = dscOpenZones[7] ^ dscPreviousOpenZones[7];
-    if (zonesChanged != 0) {
-      dscPreviousOpenZones[7] = dscOpenZones[7];
-      dscOpenZonesStatusChanged = true;
-      if (!dscPauseStatus) dscStatusChanged = true;
+  dscOpenZones[7] = dscPanelData[3];
+  byte zonesChanged = dscOpenZones[7] ^ dscPreviousOpenZones[7];
+  if (zonesChanged != 0) {
+    dscPreviousOpenZones[7] = dscOpenZones[7];
+    dscOpenZonesStatusChanged = true;
+    if (!dscPauseStatus) dscStatusChanged = true;
 
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(dscOpenZonesChanged[7], zoneBit, 1);
-          if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[7], zoneBit, 1);
-          else bitWrite(dscOpenZones[7], zoneBit, 0);
-        }
+    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
+      if (bitRead(zonesChanged, zoneBit)) {
+        bitWrite(dscOpenZonesChanged[7], zoneBit, 1);
+        dscEmitEvent(DSC_EVENT_ZONE_OPEN, zoneBit + 56, bitRead(dscOpenZones[7], zoneBit));
+        if (bitRead(dscPanelData[3], zoneBit)) bitWrite(dscOpenZones[7], zoneBit, 1);
+        else bitWrite(dscOpenZones[7], zoneBit, 0);
       }
     }
   }
 }
+#endif
@@ -0,0 +1,112 @@
+/*
+    DSC Keybus Interface
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dscKeybusInterface-RTOS.h"
+
+#if dscIsrProfile
+
+// Adds the call started at startCycles to the path, called at the exit of dscClockInterrupt() and dscDataInterrupt()
+void IRAM dscIsrProfileAdd(byte path, uint32_t startCycles) {
+  uint32_t now = dscCycleCount();
+  uint32_t cycles = now - startCycles;
+
+  dscIsrCounters *counters = &dscIsrProfilePaths[path];
+  counters->count++;
+  counters->cycles += cycles;
+  if (cycles > counters->max) counters->max = cycles;
+  counters->windowCount++;
+  counters->windowCycles += cycles;
+
+  // Keeps the counts of the last complete second for the CPU share
+  if (now - dscIsrProfileWindowStart >= dscIsrProfileSecond) {
+    for (byte i = 0; i < DSC_ISR_PATHS; i++) {
+      dscIsrProfilePaths[i].secondCount = dscIsrProfilePaths[i].windowCount;
+      dscIsrProfilePaths[i].secondCycles = dscIsrProfilePaths[i].windowCycles;
+      dscIsrProfilePaths[i].windowCount = 0;
+      dscIsrProfilePaths[i].windowCycles = 0;
+    }
+    dscIsrProfileWindowStart = now;
+  }
+}
+
+
+/*
+ *  Interrupt profiling API
+ */
+
+
+// Summarizes the path, or all paths if path is -1.  Returns false if the path has no calls.
+bool dscIsrProfileRead(int path, dscIsrSummary *summary) {
+  memset(summary, 0, sizeof(dscIsrSummary));
+  if (path >= DSC_ISR_PATHS) return false;
+
+  dscIsrCounters counters[DSC_ISR_PATHS];
+  taskENTER_CRITICAL();
+  memcpy(counters, dscIsrProfilePaths, sizeof(counters));
+  uint32_t windowAge = dscCycleCount() - dscIsrProfileWindowStart;
+  taskEXIT_CRITICAL();
+
+  // The last complete second is stale if the interrupts stopped before the current second ended
+  bool stale = windowAge >= 2 * dscIsrProfileSecond;
+
+  uint64_t cycles = 0, secondCycles = 0;
+  for (byte i = 0; i < DSC_ISR_PATHS; i++) {
+    if (path >= 0 && path != i) continue;
+    summary->count += counters[i].count;
+    if (counters[i].max > summary->max) summary->max = counters[i].max;
+    cycles += counters[i].cycles;
+    if (!stale) {
+      summary->callsPerSecond += counters[i].secondCount;
+      secondCycles += counters[i].secondCycles;
+    }
+  }
+  if (summary->count == 0) return false;
+
+  summary->mean = cycles / summary->count;
+  summary->share = (secondCycles * 10000) / dscIsrProfileSecond;
+  return true;
+}
+
+
+void dscIsrProfileReset() {
+  taskENTER_CRITICAL();
+  memset(dscIsrProfilePaths, 0, sizeof(dscIsrProfilePaths));
+  dscIsrProfileWindowStart = dscCycleCount();
+  taskEXIT_CRITICAL();
+}
+
+
+// Prints a table of each path with calls and the total for all paths
+void dscIsrProfilePrint() {
+  static const char *pathNames[DSC_ISR_PATHS] = {
+    "clock", "write", "panel bit", "module bit", "commit"
+  };
+
+  dscPrintf("Interrupts       calls  mean cycles  max cycles  calls/s    CPU %%\n");
+  for (int path = 0; path <= DSC_ISR_PATHS; path++) {
+    dscIsrSummary summary;
+    if (!dscIsrProfileRead(path < DSC_ISR_PATHS ? path : -1, &summary)) continue;
+    dscPrintf("%-10s %11lu %12lu %11lu %8lu %5lu.%02lu\n", path < DSC_ISR_PATHS ? pathNames[path] : "all",
+              (unsigned long) summary.count, (unsigned long) summary.mean, (unsigned long) summary.max,
+              (unsigned long) summary.callsPerSecond, (unsigned long) summary.share / 100,
+              (unsigned long) summary.share % 100);
+  }
+}
+
+#endif  // dscIsrProfile
@@ -0,0 +1,151 @@
+/*
+    DSC Keybus Interface
+
+    https://github.com/taligentx/dscKeybusInterface-RTOS
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ *  Binary Keybus trace format
+ *
+ *  A trace starts with the 5 byte dscTraceHeader ("DSCT" and the format version), followed by one record per panel
+ *  command or keypad/module response:
+ *
+ *    Byte 0: Length of the record, excluding this byte
+ *    Byte 1: Flags - DSC_TRACE_MODULE, DSC_TRACE_OVERFLOW
+ *    Byte 2: Microseconds since the previous record, 7 bits per byte, least significant first - bit 7 is set in each
+ *            byte except the last (1-5 bytes)
+ *    Next:   Bit count
+ *    Next:   Panel command the keypad or module responded to (module records only)
+ *    Next:   Data bytes in the same layout as dscPanelData[] and dscModuleData[], including the stop bit in byte 1
+ *
+ *  A 0x05 status command is 12 bytes, compared to ~60 characters printed as binary by KeybusReader.  A reader of a
+ *  serial stream can skip any output before the trace header.
+ */
+
+#include "dscKeybusInterface-RTOS.h"
+
+
+// Starts queueing each panel command and keypad/module response to dscTraceQueue before the commands are filtered,
+// for a task to encode and send the trace
+void dscTraceBegin() {
+  if (dscTraceQueue == NULL) dscTraceQueue = xQueueCreate(dscTraceQueueSize, sizeof(dscTraceRecord));
+}
+
+
+// Queues a command for the trace, called by dscPanelLoop() and dscHandleModule()
+void dscTraceFrame(const byte *data, byte bitCount, byte byteCount, uint32_t time, byte flags, byte panelCommand) {
+  static bool traceOverflow = false;
+
+  if (dscTraceOverflow) {
+    dscTraceOverflow = false;
+    traceOverflow = true;
+  }
+
+  dscTraceRecord record;
+  record.time = time;
+  record.flags = flags;
+  if (traceOverflow) record.flags |= DSC_TRACE_OVERFLOW;
+  record.bitCount = bitCount;
+  record.byteCount = byteCount;
+  record.panelCommand = panelCommand;
+  for (byte i = 0; i < byteCount; i++) record.data[i] = data[i];
+
+  if (xQueueSendToBack(dscTraceQueue, &record, 0) == pdPASS) traceOverflow = false;
+  else traceOverflow = true;  // Marks the next queued record
+}
+
+
+// Encodes a record to output, which must hold dscTraceRecordSize bytes - previousTime is the time of the previous
+// record in the trace and is updated.  Returns the encoded length.
+byte dscTraceEncode(const dscTraceRecord *record, uint32_t *previousTime, byte *output) {
+  byte length = 1;
+  output[length++] = record->flags;
+
+  uint32_t timeDelta = record->time - *previousTime;
+  *previousTime = record->time;
+  while (timeDelta >= 0x80) {
+    output[length++] = (timeDelta & 0x7F) | 0x80;
+    timeDelta >>= 7;
+  }
+  output[length++] = timeDelta;
+
+  output[length++] = record->bitCount;
+  if (record->flags & DSC_TRACE_MODULE) output[length++] = record->panelCommand;
+
+  byte byteCount = record->byteCount;
+  if (byteCount > dscReadSize) byteCount = dscReadSize;
+  for (byte i = 0; i < byteCount; i++) output[length++] = record->data[i];
+
+  output[0] = length - 1;
+  return length;
+}
+
+
+// Decodes a record from input - previousTime is the time of the previous record in the trace and is updated.  Returns
+// the length of the encoded record, 0 if input does not yet hold the complete record, or -1 if the record is invalid.
+int dscTraceDecode(const byte *input, int length, uint32_t *previousTime, dscTraceRecord *record) {
+  if (length < 1 || length < input[0] + 1) return 0;
+  byte recordLength = input[0] + 1;
+  byte position = 1;
+
+  if (position >= recordLength) return -1;
+  record->flags = input[position++];
+
+  uint32_t timeDelta = 0;
+  byte shift = 0;
+  do {
+    if (position >= recordLength || shift > 28) return -1;
+    timeDelta |= (uint32_t)(input[position] & 0x7F) << shift;
+    shift += 7;
+  } while (input[position++] & 0x80);
+  *previousTime += timeDelta;
+  record->time = *previousTime;
+
+  if (position >= recordLength) return -1;
+  record->bitCount = input[position++];
+
+  record->panelCommand = 0;
+  if (record->flags & DSC_TRACE_MODULE) {
+    if (position >= recordLength) return -1;
+    record->panelCommand = input[position++];
+  }
+
+  byte byteCount = recordLength - position;
+  if (byteCount > dscReadSize) return -1;
+  record->byteCount = byteCount;
+  for (byte i = 0; i < byteCount; i++) record->data[i] = input[position++];
+  for (byte i = byteCount; i < dscReadSize; i++) record->data[i] = 0;
+
+  return recordLength;
+}
+
+
+// Points dscPanelData or dscModuleData to a decoded record so it can be printed with the dscPrint functions
+void dscTraceLoad(const dscTraceRecord *record) {
+  if (record->flags & DSC_TRACE_MODULE) {
+    dscModuleData = record->data;
+    dscModuleBitCount = record->bitCount;
+    dscModuleByteCount = record->byteCount;
+    dscModuleCmd = record->panelCommand;
+  }
+  else {
+    dscPanelData = record->data;
+    dscPanelFrame = NULL;
+    dscPanelBitCount = record->bitCount;
+    dscPanelByteCount = record->byteCount;
+  }
+}